@@ -2,7 +2,10 @@
 
 #include <algorithm>
 #include <iostream>
+#include <memory_resource>
+#include <new>
 #include <random>
+#include <type_traits>
 #include <vector>
 #include <stack>
 
@@ -21,6 +24,14 @@ namespace Containers
         /*  >>> Члены данных. <<<  */
         TreeNode* root;                                             // Указатель на корень (начальный узел) дерева.
         size_t sizeOfTree;                                          // Текущее количество узлов в дереве.
+        std::pmr::memory_resource* resource;                        // Ресурс памяти для узлов (nullptr - обычная куча).
+
+
+        /*  >>> Вспомогательные защищенные методы для управления памятью узлов. <<<  */
+        TreeNode* createNode(const T& value);                       // Создание узла (в куче или у ресурса памяти).
+        void destroyNode(TreeNode* currNode);                       // Уничтожение узла и освобождение его памяти.
+        void forget(TreeNode* currNode);                            // Уничтожение значений поддерева без освобождения памяти.
+        bool sharesResourceWith(const BinarySearchTree& other) const; // Совместимы ли ресурсы памяти двух деревьев.
 
 
         /*  >>> Вспомогательные защищенные методы для изменения дерева. <<<  */
@@ -38,6 +49,7 @@ namespace Containers
 
         /*  >>> Вспомогательные защищенные методы для копирования дерева. <<<  */
         TreeNode* copyTree(TreeNode* currNode);                     // Глубокое копирование дерева / поддерева.
+        TreeNode* buildBalanced(const T* values, size_t count);     // Построение сбалансированного дерева из отсортированного массива.
 
 
     public:
@@ -52,6 +64,7 @@ namespace Containers
 
         /*  >>> Конструкторы и деструктор. <<<  */
         BinarySearchTree();                                         // Конструктор по умолчанию.
+        explicit BinarySearchTree(std::pmr::memory_resource* memoryResource); // Конструктор с ресурсом памяти для узлов.
         BinarySearchTree(const std::initializer_list<T>& someList); // Пользовательский конструктор.
         BinarySearchTree(const BinarySearchTree& other);            // Конструктор глубокого копирования.
         BinarySearchTree(BinarySearchTree&& other);                 // Конструктор перемещения.
@@ -66,13 +79,16 @@ namespace Containers
         /*  >>> Публичные методы для изменения дерева. <<<  */
         void push(const T& value);                                  // Добавление элемента в дерево.
         void reconstruct();                                         // Реконструкция дерева (в случае его неверной структуры / плохой сбалансированности). 
+        void assignSorted(const std::vector<T>& sorted);            // Замена содержимого сбалансированным деревом из отсортированных значений.
         void clear();                                               // Полная очистка дерева.
+        void release();                                             // Очистка дерева без освобождения памяти узлов (для арены).
 
 
         /*  >>> Публичные методы для получения информации о дереве. <<<  */
         bool isEmpty() const;                                       // Проверка, пустое ли дерево.
         size_t height() const;                                      // Возвращает текущую высоту дерева.
         size_t size() const;                                        // Возвращает количество узлов в дереве.
+        std::pmr::memory_resource* memoryResource() const;          // Возвращает ресурс памяти узлов (nullptr - обычная куча).
 
 
         /*  >>> Публичные методы для осуществления поиска в дереве. <<<  */
@@ -109,6 +125,65 @@ namespace Containers
 
 
     
+    /*  >>> Вспомогательные защищенные методы для управления памятью узлов. <<<  */
+    template<typename T>
+    typename BinarySearchTree<T>::TreeNode* BinarySearchTree<T>::createNode(const T& value)
+    {
+        // 1. Если ресурс памяти не задан - узел создаётся в обычной куче.
+        if (resource == nullptr) {
+            return new TreeNode(value);
+        }
+
+        // 2. Иначе - беру память у ресурса и создаю в ней узел.
+        void* memory = resource->allocate(sizeof(TreeNode), alignof(TreeNode));
+
+        try {
+            return new (memory) TreeNode(value);
+        }
+        catch (...)
+        {
+            resource->deallocate(memory, sizeof(TreeNode), alignof(TreeNode));
+            throw;
+        }
+    }
+
+    template<typename T>
+    void BinarySearchTree<T>::destroyNode(TreeNode* currNode)
+    {
+        if (resource == nullptr) 
+        {
+            delete currNode;
+            return;
+        }
+
+        currNode->~TreeNode();
+        resource->deallocate(currNode, sizeof(TreeNode), alignof(TreeNode));
+    }
+
+    template<typename T>
+    void BinarySearchTree<T>::forget(TreeNode* currNode)
+    {
+        if (currNode == nullptr) { return; }
+
+        forget(currNode->left);
+        forget(currNode->right);
+
+        // Вызываю только деструктор: память узла вернётся вместе с памятью ресурса.
+        currNode->~TreeNode();
+    }
+
+    template<typename T>
+    bool BinarySearchTree<T>::sharesResourceWith(const BinarySearchTree& other) const
+    {
+        if (resource == nullptr || other.resource == nullptr) {
+            return resource == other.resource;
+        }
+
+        return resource->is_equal(*other.resource);
+    }
+
+
+
     /*  >>> Вспомогательные защищенные методы для изменения дерева. <<<  */
     template<typename T>
     void BinarySearchTree<T>::push(TreeNode*& currNode, const T& value)
@@ -119,7 +194,7 @@ namespace Containers
         {
             /* 1.1  Создаю новый узел и присваиваю указатель на него переменной currNode,
                     тем самым связывая новый узел с родительским (посредством указателя currNode).  */
-            currNode = new TreeNode(value);
+            currNode = createNode(value);
 
             ++sizeOfTree;
             return;
@@ -146,7 +221,7 @@ namespace Containers
         clear(currNode->right);
 
         // 3. Удаляю текущий узел.
-        delete currNode;
+        destroyNode(currNode);
     }
 
 
@@ -196,7 +271,7 @@ namespace Containers
         if (currNode == nullptr) { return nullptr; }
     
         // 2. Создаю новый узел с таким же значением, как у текущего узла.
-        TreeNode* newNode = new TreeNode(currNode->value);
+        TreeNode* newNode = createNode(currNode->value);
     
         // 3. Рекурсивно копирую поддеревья и присваиваю результат соответствующему потомку нового узла.
         newNode->left = copyTree(currNode->left);
@@ -206,6 +281,32 @@ namespace Containers
         return newNode;
     }
 
+    template<typename T>
+    typename BinarySearchTree<T>::TreeNode* BinarySearchTree<T>::buildBalanced(const T* values, size_t count)
+    {
+        // 1. Пустой диапазон - пустое поддерево (базовый случай рекурсии).
+        if (count == 0) { return nullptr; }
+
+        /* 2.   Корнем поддерева становится средний элемент, левая и правая половины - его поддеревьями.
+                Равные корню значения могут попасть в любое из поддеревьев - поиск это допускает,
+                так как слева остаются значения не больше корня, а справа - не меньше.   */
+        const size_t middle = count / 2;
+        TreeNode* newNode = createNode(values[middle]);
+
+        try
+        {
+            newNode->left  = buildBalanced(values, middle);
+            newNode->right = buildBalanced(values + middle + 1, count - middle - 1);
+        }
+        catch (...)
+        {
+            clear(newNode);
+            throw;
+        }
+
+        return newNode;
+    }
+
 
 
     /*  >>> Структура итератора. <<<  */
@@ -318,7 +419,11 @@ namespace Containers
 
     /*  >>> Конструкторы и деструктор. <<<  */
     template <typename T>
-    BinarySearchTree<T>::BinarySearchTree() : root(nullptr), sizeOfTree(0) {}
+    BinarySearchTree<T>::BinarySearchTree() : root(nullptr), sizeOfTree(0), resource(nullptr) {}
+
+    template <typename T>
+    BinarySearchTree<T>::BinarySearchTree(std::pmr::memory_resource* memoryResource) 
+        : root(nullptr), sizeOfTree(0), resource(memoryResource) {}
 
     template <typename T>
     BinarySearchTree<T>::BinarySearchTree(const std::initializer_list<T> &someList) : BinarySearchTree() 
@@ -329,12 +434,13 @@ namespace Containers
     }
 
     template<typename T>
-    BinarySearchTree<T>::BinarySearchTree(const BinarySearchTree& other) : sizeOfTree(other.sizeOfTree) {
+    BinarySearchTree<T>::BinarySearchTree(const BinarySearchTree& other) : sizeOfTree(other.sizeOfTree), resource(nullptr) {
         root = copyTree(other.root);
     }
 
     template<typename T>
-    BinarySearchTree<T>::BinarySearchTree(BinarySearchTree&& other) : root(other.root), sizeOfTree(other.sizeOfTree)
+    BinarySearchTree<T>::BinarySearchTree(BinarySearchTree&& other) 
+        : root(other.root), sizeOfTree(other.sizeOfTree), resource(other.resource)
     {
         other.root = nullptr;
         other.sizeOfTree = 0;
@@ -380,11 +486,22 @@ namespace Containers
         // 2. Полностью очищаю дерево.
         clear();
 
-        // 3. *Забираю ресурсы*.
+        /* 3.   Если узлы другого дерева выделены из несовместимого ресурса памяти - забрать их нельзя,
+                поэтому копирую дерево в свой ресурс и очищаю другое дерево.   */
+        if (!sharesResourceWith(other))
+        {
+            root = copyTree(other.root);
+            sizeOfTree = other.sizeOfTree;
+
+            other.clear();
+            return *this;
+        }
+
+        // 4. *Забираю ресурсы*.
         root = other.root;
         sizeOfTree = other.sizeOfTree;
 
-        // 4. *Обнуляю* указатель на корень r-value объекта и его размер.
+        // 5. *Обнуляю* указатель на корень r-value объекта и его размер.
         other.root = nullptr;
         other.sizeOfTree = 0;
 
@@ -422,6 +539,25 @@ namespace Containers
         }
     }
 
+    template<typename T>
+    void BinarySearchTree<T>::assignSorted(const std::vector<T>& sorted)
+    {
+        // 1. Проверяю, что значения действительно отсортированы (иначе получится неверное дерево поиска).
+        for (size_t i = 1; i < sorted.size(); ++i)
+        {
+            if (sorted[i] < sorted[i - 1]) {
+                throw std::runtime_error("Error! The values must be sorted to build a balanced tree.");
+            }
+        }
+
+        // 2. Полностью очищаю текущее дерево.
+        clear();
+
+        // 3. Строю сбалансированное дерево за O(n) - без n вставок с поиском места.
+        root = buildBalanced(sorted.data(), sorted.size());
+        sizeOfTree = sorted.size();
+    }
+
     template<typename T>
     void BinarySearchTree<T>::clear()
     {
@@ -435,6 +571,29 @@ namespace Containers
 
 
 
+    template<typename T>
+    void BinarySearchTree<T>::release()
+    {
+        // 1. Без ресурса памяти "забыть" узлы нельзя (будет утечка) - выполняю обычную очистку.
+        if (resource == nullptr) 
+        {
+            clear();
+            return;
+        }
+
+        /* 2.   Узлы выделены из ресурса (арены) - их память вернётся при его сбросе.
+                Для типов с тривиальным деструктором обходить дерево не нужно вовсе (O(1)).   */
+        if constexpr (!std::is_trivially_destructible<T>::value) {
+            forget(root);
+        }
+
+        // 3. *Обнуляю* указатель на корень и размер дерева.
+        root = nullptr;
+        sizeOfTree = 0;
+    }
+
+
+
     /*  >>> Публичные методы для получения информации о дереве. <<<  */
     template<typename T>
     bool BinarySearchTree<T>::isEmpty() const {
@@ -451,6 +610,11 @@ namespace Containers
         return sizeOfTree;
     }
 
+    template<typename T>
+    std::pmr::memory_resource* BinarySearchTree<T>::memoryResource() const {
+        return resource;
+    }
+
 
 
     /*  >>> Публичные методы для осуществления поиска в дереве. <<<  */
@@ -0,0 +1,586 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Пространство имен Containers предназначено для хранения различных контейнеров.
+namespace Containers
+{
+    /* ConcurrentQueue - неблокирующая очередь для многих производителей и многих потребителей (алгоритм Майкла - Скотта).
+       Элементы хранятся в односвязной цепочке узлов, как в LinkedList; в начале цепочки всегда стоит фиктивный узел.
+       Добавление присоединяет узел к последнему узлу через compare_exchange, извлечение сдвигает голову на следующий узел,
+       а отставший указатель на хвост продвигает любой поток, который это заметил. Блокировок нет: остановка одного
+       потока не мешает остальным.
+       Память извлечённых узлов освобождается через указатели опасности (hazard pointers): перед разыменованием поток
+       публикует адрес узла в своей записи, а удалённый узел освобождается лишь тогда, когда его адреса нет ни в одной записи.
+       Каждый поток закрепляет за собой одну запись в каждой очереди, с которой работает, и возвращает её при завершении,
+       поэтому операция не обходит список записей и не конкурирует за них с другими потоками; число потоков не ограничено.
+       Важно! Перемещающее присваивание T не должно выбрасывать исключений. */
+    template<typename T>
+    class ConcurrentQueue
+    {
+    private:
+        /* === Узел очереди (значение создаётся при добавлении и уничтожается при извлечении): === */
+        struct Node
+        {
+            std::atomic<Node*> next{ nullptr };                 // Следующий узел цепочки.
+            alignas(T) unsigned char storage[sizeof(T)];        // Память под значение (у фиктивного узла пуста).
+
+            T* object() { return reinterpret_cast<T*>(storage); }
+        };
+
+        /* === Запись указателей опасности (закрепляется за потоком): === */
+        struct alignas(64) HazardRecord
+        {
+            std::atomic<Node*>  hazard[2] = {};                 // Узлы, которые поток сейчас разыменовывает.
+            std::atomic<bool>   active{ false };                // Запись занята потоком.
+            bool                inUse = false;                  // Запись занята операцией (меняет только поток-владелец).
+            HazardRecord*       next = nullptr;                 // Следующая запись (записи только добавляются).
+            std::vector<Node*>  retired;                        // Извлечённые узлы, ожидающие освобождения.
+        };
+
+        /* === Список записей (отдельный объект: поток при завершении возвращает запись, только если он ещё жив): === */
+        struct HazardRegistry
+        {
+            std::atomic<HazardRecord*> records{ nullptr };      // Все записи указателей опасности.
+            std::atomic<size_t>        recordCount{ 0 };        // Количество записей.
+
+            ~HazardRegistry();                                  // Освобождение записей и ожидающих узлов.
+        };
+
+        /* === Записи, закреплённые за текущим потоком (по одной на очередь): === */
+        struct ThreadRecords;
+
+        /* === Занятие записи на время операции (освобождается в деструкторе): === */
+        class HazardGuard;
+
+
+        /* === Количество удалённых узлов записи, сверх которого запускается освобождение: === */
+        static constexpr size_t retiredReserve = 64;
+
+
+        /* === Данные очереди (голова и хвост - в разных кеш-линиях, чтобы потребители не мешали производителям): === */
+        alignas(64) std::atomic<Node*> head;                    // Фиктивный узел перед первым элементом.
+        alignas(64) std::atomic<Node*> tail;                    // Последний или предпоследний узел цепочки.
+        alignas(64) std::shared_ptr<HazardRegistry> registry;   // Записи указателей опасности.
+        uint64_t id;                                            // Номер очереди (не повторяется, в отличие от адреса).
+
+        static inline std::atomic<uint64_t> nextId{ 1 };        // Номер следующей созданной очереди.
+
+
+        /* === Вспомогательные методы: === */
+        HazardRecord* acquireRecord() const;                    // Занятие свободной записи (или создание новой).
+        static void   releaseRecord(HazardRecord* record);      // Освобождение записи.
+        HazardRecord* threadRecord() const;                     // Запись, закреплённая за текущим потоком.
+
+        static Node* protect(std::atomic<Node*>& hazard, const std::atomic<Node*>& source); // Публикация узла из source.
+
+        void retire(HazardRecord* record, Node* node);          // Отложенное освобождение извлечённого узла.
+        void scan(HazardRecord* record);                        // Освобождение узлов, которых нет в указателях опасности.
+
+        template<typename U>
+        static Node* createNode(U&& value);                     // Новый узел со значением.
+        static void  destroyChain(Node* first);                 // Уничтожение цепочки узлов вместе со значениями.
+
+        void linkChain(Node* first, Node* last, HazardRecord* record); // Присоединение готовой цепочки к хвосту.
+        Node* popNode(HazardRecord* record);                    // Извлечение узла с первым элементом (nullptr - очередь пуста).
+
+
+    public:
+        /* === Конструкторы и деструктор: === */
+        ConcurrentQueue();                                      // Конструктор по умолчанию (создаёт фиктивный узел).
+
+        ConcurrentQueue(const ConcurrentQueue&) = delete;               // Копирование запрещено.
+        ConcurrentQueue& operator=(const ConcurrentQueue&) = delete;    // Присваивание запрещено.
+
+        ~ConcurrentQueue();                                     // Деструктор (вызывается, когда с очередью уже никто не работает).
+
+
+        /* === Методы для добавления элементов (потокобезопасны, без блокировок): === */
+        void push(const T& value);                              // Добавление копии элемента в конец очереди.
+        void push(T&& value);                                   // Добавление элемента перемещением.
+
+        bool tryPush(const T& value) noexcept;                  // Добавление без исключений (false - не удалось создать узел).
+        bool tryPush(T&& value) noexcept;
+
+        template<typename InputIt>
+        size_t pushBulk(InputIt first, InputIt last);           // Добавление диапазона одной операцией над хвостом.
+
+
+        /* === Методы для извлечения элементов (потокобезопасны, без блокировок): === */
+        bool tryPop(T& result);                                 // Извлечение первого элемента (false - очередь пуста).
+
+        template<typename OutputIt>
+        size_t popBulk(OutputIt output, size_t maxCount);       // Извлечение до maxCount элементов, возвращает их количество.
+
+
+        /* === Методы для получения информации об очереди: === */
+        bool isEmpty() const;                                   // Проверка на пустоту (в момент вызова).
+    };
+
+} // namespace Containers.
+
+
+
+/* ... ОПРЕДЕЛЕНИЕ ФУНКЦИОНАЛЬНОСТИ КЛАССА ... */
+namespace Containers
+{
+
+    /* === Описание записей, закреплённых за потоком: === */
+    template<typename T>
+    struct ConcurrentQueue<T>::ThreadRecords
+    {
+        struct Entry
+        {
+            uint64_t                      queueId;              // Номер очереди.
+            std::weak_ptr<HazardRegistry> registry;             // Список записей очереди (истекает вместе с очередью).
+            HazardRecord*                 record;               // Закреплённая запись.
+        };
+
+        std::vector<Entry> entries;
+
+        // При завершении потока записи возвращаются тем очередям, которые ещё существуют.
+        ~ThreadRecords()
+        {
+            for (Entry& entry : entries) {
+                if (std::shared_ptr<HazardRegistry> alive = entry.registry.lock()) { releaseRecord(entry.record); }
+            }
+        }
+    };
+
+
+    /* === Описание занятия записи указателей опасности: === */
+    template<typename T>
+    class ConcurrentQueue<T>::HazardGuard
+    {
+    private:
+        HazardRecord* record;
+        bool          pinned;                                   // Запись закреплена за потоком (иначе взята из общего списка).
+
+    public:
+        /* Обычно операция берёт закреплённую запись потока. Если она уже занята (вложенная операция над той же очередью,
+           например из конструктора T), берётся свободная запись из общего списка, как прежде. */
+        explicit HazardGuard(const ConcurrentQueue& queue) : record(queue.threadRecord()), pinned(!record->inUse)
+        {
+            if (pinned) { record->inUse = true; }
+            else { record = queue.acquireRecord(); }
+        }
+
+        HazardGuard(const HazardGuard&) = delete;
+        HazardGuard& operator=(const HazardGuard&) = delete;
+
+        ~HazardGuard()
+        {
+            if (!pinned)
+            {
+                releaseRecord(record);
+                return;
+            }
+
+            // Закреплённая запись остаётся за потоком - снимаю только указатели опасности.
+            record->hazard[0].store(nullptr, std::memory_order_release);
+            record->hazard[1].store(nullptr, std::memory_order_release);
+            record->inUse = false;
+        }
+
+        HazardRecord* get() const { return record; }
+    };
+
+
+    /* === Вспомогательные защищенные методы: === */
+    template<typename T>
+    ConcurrentQueue<T>::HazardRegistry::~HazardRegistry()
+    {
+        // Удалённые узлы уже без значений - освобождаю только память.
+        HazardRecord* record = records.load(std::memory_order_acquire);
+
+        while (record != nullptr)
+        {
+            HazardRecord* next = record->next;
+
+            for (Node* node : record->retired) { delete node; }
+            delete record;
+
+            record = next;
+        }
+    }
+
+    template<typename T>
+    typename ConcurrentQueue<T>::HazardRecord* ConcurrentQueue<T>::acquireRecord() const
+    {
+        std::atomic<HazardRecord*>& records = registry->records;
+
+        // 1. Ищу свободную запись среди существующих.
+        for (HazardRecord* record = records.load(std::memory_order_acquire); record != nullptr; record = record->next)
+        {
+            bool expected = false;
+
+            if (!record->active.load(std::memory_order_relaxed) &&
+                record->active.compare_exchange_strong(expected, true, std::memory_order_acquire, std::memory_order_relaxed)) {
+                return record;
+            }
+        }
+
+        // 2. Все записи заняты - создаю новую и добавляю её в начало списка записей.
+        HazardRecord* record = new HazardRecord;
+        record->active.store(true, std::memory_order_relaxed);
+        record->next = records.load(std::memory_order_relaxed);
+
+        while (!records.compare_exchange_weak(record->next, record, std::memory_order_release, std::memory_order_relaxed)) {}
+
+        registry->recordCount.fetch_add(1, std::memory_order_relaxed);
+        return record;
+    }
+
+    template<typename T>
+    typename ConcurrentQueue<T>::HazardRecord* ConcurrentQueue<T>::threadRecord() const
+    {
+        static thread_local ThreadRecords pinned;
+
+        // 1. Поток обычно работает с одной-двумя очередями, поэтому линейный поиск по номеру очереди дёшев и без атомарных операций.
+        for (const typename ThreadRecords::Entry& entry : pinned.entries) {
+            if (entry.queueId == id) { return entry.record; }
+        }
+
+        // 2. Первое обращение потока к очереди: забываю записи уже уничтоженных очередей и закрепляю свободную запись.
+        size_t kept = 0;
+
+        for (typename ThreadRecords::Entry& entry : pinned.entries) {
+            if (!entry.registry.expired()) { pinned.entries[kept++] = std::move(entry); }
+        }
+
+        pinned.entries.erase(pinned.entries.begin() + kept, pinned.entries.end());
+
+        HazardRecord* record = acquireRecord();
+
+        try { pinned.entries.push_back({ id, registry, record }); }
+        catch (...)
+        {
+            releaseRecord(record);
+            throw;
+        }
+
+        return record;
+    }
+
+    template<typename T>
+    void ConcurrentQueue<T>::releaseRecord(HazardRecord* record)
+    {
+        record->hazard[0].store(nullptr, std::memory_order_release);
+        record->hazard[1].store(nullptr, std::memory_order_release);
+
+        // release передаёт следующему владельцу записи и её список удалённых узлов.
+        record->active.store(false, std::memory_order_release);
+    }
+
+    template<typename T>
+    typename ConcurrentQueue<T>::Node* ConcurrentQueue<T>::protect(std::atomic<Node*>& hazard, const std::atomic<Node*>& source)
+    {
+        // Узел защищён, только если после публикации он всё ещё лежит в source: иначе его могли успеть освободить.
+        Node* node = source.load();
+
+        for (;;)
+        {
+            hazard.store(node);
+
+            Node* current = source.load();
+            if (current == node) { return node; }
+
+            node = current;
+        }
+    }
+
+    template<typename T>
+    void ConcurrentQueue<T>::retire(HazardRecord* record, Node* node)
+    {
+        record->retired.push_back(node);
+
+        // Порог растёт вместе с числом указателей опасности - так каждый просмотр освобождает большую часть узлов.
+        if (record->retired.size() >= 2 * 2 * registry->recordCount.load(std::memory_order_relaxed) + retiredReserve) {
+            scan(record);
+        }
+    }
+
+    template<typename T>
+    void ConcurrentQueue<T>::scan(HazardRecord* record)
+    {
+        // 1. Собираю все опубликованные указатели опасности.
+        std::vector<Node*> hazards;
+
+        for (HazardRecord* other = registry->records.load(std::memory_order_acquire); other != nullptr; other = other->next)
+        {
+            for (std::atomic<Node*>& hazard : other->hazard)
+            {
+                Node* node = hazard.load();
+                if (node != nullptr) { hazards.push_back(node); }
+            }
+        }
+
+        std::sort(hazards.begin(), hazards.end());
+
+        // 2. Освобождаю узлы, которые никто не защищает; остальные остаются до следующего просмотра.
+        std::vector<Node*>& retired = record->retired;
+        size_t kept = 0;
+
+        for (Node* node : retired)
+        {
+            if (std::binary_search(hazards.begin(), hazards.end(), node)) { retired[kept++] = node; }
+            else { delete node; }
+        }
+
+        retired.resize(kept);
+    }
+
+    template<typename T>
+    template<typename U>
+    typename ConcurrentQueue<T>::Node* ConcurrentQueue<T>::createNode(U&& value)
+    {
+        Node* node = new Node;
+
+        try {
+            new (node->storage) T(std::forward<U>(value));
+        }
+        catch (...)
+        {
+            delete node;
+            throw;
+        }
+
+        return node;
+    }
+
+    template<typename T>
+    void ConcurrentQueue<T>::destroyChain(Node* first)
+    {
+        while (first != nullptr)
+        {
+            Node* next = first->next.load(std::memory_order_relaxed);
+
+            first->object()->~T();
+            delete first;
+
+            first = next;
+        }
+    }
+
+    template<typename T>
+    void ConcurrentQueue<T>::linkChain(Node* first, Node* last, HazardRecord* record)
+    {
+        for (;;)
+        {
+            Node* currTail = protect(record->hazard[0], tail);
+            Node* next = currTail->next.load(std::memory_order_acquire);
+
+            // 1. Хвост отстал - помогаю его продвинуть и пробую снова.
+            if (next != nullptr)
+            {
+                tail.compare_exchange_weak(currTail, next, std::memory_order_release, std::memory_order_relaxed);
+                continue;
+            }
+
+            // 2. Присоединяю цепочку к последнему узлу; release публикует созданные значения.
+            if (currTail->next.compare_exchange_weak(next, first, std::memory_order_release, std::memory_order_relaxed))
+            {
+                // 3. Сдвигаю хвост на конец цепочки (неудача означает, что его уже продвинул другой поток).
+                tail.compare_exchange_strong(currTail, last, std::memory_order_release, std::memory_order_relaxed);
+                return;
+            }
+        }
+    }
+
+    template<typename T>
+    typename ConcurrentQueue<T>::Node* ConcurrentQueue<T>::popNode(HazardRecord* record)
+    {
+        /* Возвращаемый узел стал фиктивным, а его значение принадлежит вызывающему потоку: тот забирает и уничтожает
+           значение, пока узел защищён record->hazard[1] (другой поток может уже извлечь следующий элемент и удалить этот узел). */
+        for (;;)
+        {
+            // 1. Защищаю голову и её следующий узел; если голова за это время сменилась - начинаю заново.
+            Node* currHead = protect(record->hazard[0], head);
+            Node* next = currHead->next.load(std::memory_order_acquire);
+
+            record->hazard[1].store(next);
+            if (head.load() != currHead) { continue; }
+
+            // 2. За фиктивным узлом ничего нет - очередь пуста.
+            if (next == nullptr) { return nullptr; }
+
+            // 3. Хвост отстал и указывает на голову - сначала продвигаю его, иначе хвост окажется на освобождённом узле.
+            Node* currTail = tail.load(std::memory_order_acquire);
+
+            if (currHead == currTail)
+            {
+                tail.compare_exchange_strong(currTail, next, std::memory_order_release, std::memory_order_relaxed);
+                continue;
+            }
+
+            // 4. Сдвигаю голову: next становится фиктивным узлом, а его значение принадлежит только этому потоку.
+            if (head.compare_exchange_strong(currHead, next, std::memory_order_acq_rel, std::memory_order_relaxed))
+            {
+                record->hazard[0].store(nullptr, std::memory_order_release);
+                retire(record, currHead);
+                return next;
+            }
+        }
+    }
+
+
+    /* === Конструкторы и деструктор: === */
+    template<typename T>
+    ConcurrentQueue<T>::ConcurrentQueue()
+        : registry(std::make_shared<HazardRegistry>()), id(nextId.fetch_add(1, std::memory_order_relaxed))
+    {
+        Node* dummy = new Node;
+
+        head.store(dummy, std::memory_order_relaxed);
+        tail.store(dummy, std::memory_order_relaxed);
+    }
+
+    template<typename T>
+    ConcurrentQueue<T>::~ConcurrentQueue()
+    {
+        /* Фиктивный узел значения не содержит, остальные узлы цепочки - содержат.
+           Записи и ожидающие освобождения узлы удалит деструктор списка записей (HazardRegistry). */
+        Node* dummy = head.load(std::memory_order_acquire);
+        destroyChain(dummy->next.load(std::memory_order_relaxed));
+        delete dummy;
+    }
+
+
+    /* === Публичные методы для добавления элементов: === */
+    template<typename T>
+    void ConcurrentQueue<T>::push(const T& value)
+    {
+        // Запись занимается до создания узла: если её не удастся создать, узел не потеряется.
+        HazardGuard guard(*this);
+
+        Node* node = createNode(value);
+        linkChain(node, node, guard.get());
+    }
+
+    template<typename T>
+    void ConcurrentQueue<T>::push(T&& value)
+    {
+        HazardGuard guard(*this);
+
+        Node* node = createNode(std::move(value));
+        linkChain(node, node, guard.get());
+    }
+
+    template<typename T>
+    bool ConcurrentQueue<T>::tryPush(const T& value) noexcept
+    {
+        try { this->push(value); }
+        catch (...) { return false; }
+
+        return true;
+    }
+
+    template<typename T>
+    bool ConcurrentQueue<T>::tryPush(T&& value) noexcept
+    {
+        try { this->push(std::move(value)); }
+        catch (...) { return false; }
+
+        return true;
+    }
+
+    template<typename T>
+    template<typename InputIt>
+    size_t ConcurrentQueue<T>::pushBulk(InputIt first, InputIt last)
+    {
+        // 1. Занимаю запись заранее, затем собираю узлы в частную цепочку (её пока не видит ни один поток).
+        HazardGuard guard(*this);
+
+        Node*  chainFirst = nullptr;
+        Node*  chainLast  = nullptr;
+        size_t count = 0;
+
+        try
+        {
+            for (; first != last; ++first, ++count)
+            {
+                Node* node = createNode(*first);
+
+                if (chainLast == nullptr) { chainFirst = node; }
+                else { chainLast->next.store(node, std::memory_order_relaxed); }
+
+                chainLast = node;
+            }
+        }
+        catch (...)
+        {
+            destroyChain(chainFirst);
+            throw;
+        }
+
+        // 2. Присоединяю всю цепочку одним compare_exchange - элементы пачки идут в очереди подряд.
+        if (count != 0) {
+            linkChain(chainFirst, chainLast, guard.get());
+        }
+
+        return count;
+    }
+
+
+    /* === Публичные методы для извлечения элементов: === */
+    template<typename T>
+    bool ConcurrentQueue<T>::tryPop(T& result)
+    {
+        HazardGuard guard(*this);
+        Node* node = popNode(guard.get());
+
+        if (node == nullptr) { return false; }
+
+        result = std::move(*node->object());
+        node->object()->~T();
+
+        return true;
+    }
+
+    template<typename T>
+    template<typename OutputIt>
+    size_t ConcurrentQueue<T>::popBulk(OutputIt output, size_t maxCount)
+    {
+        // Запись указателей опасности занимается один раз на всю пачку.
+        HazardGuard guard(*this);
+
+        size_t count = 0;
+
+        // Значение переносится прямо из узла в output, поэтому конструктор по умолчанию от T не требуется.
+        for (; count < maxCount; ++count)
+        {
+            Node* node = popNode(guard.get());
+            if (node == nullptr) { break; }
+
+            try { *output++ = std::move(*node->object()); }
+            catch (...)
+            {
+                node->object()->~T();
+                throw;
+            }
+
+            node->object()->~T();
+        }
+
+        return count;
+    }
+
+
+    /* === Публичные методы для получения информации об очереди: === */
+    template<typename T>
+    bool ConcurrentQueue<T>::isEmpty() const
+    {
+        // Голову может извлечь и освободить другой поток, поэтому перед чтением её next она защищается.
+        HazardGuard guard(*this);
+        Node* currHead = protect(guard.get()->hazard[0], head);
+
+        return currHead->next.load(std::memory_order_acquire) == nullptr;
+    }
+
+} // namespace Containers.
@@ -0,0 +1,693 @@
+#pragma once
+
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <memory_resource>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "NodeChain.h"
+#include "../Memory/NodePool.h"
+
+// Containers - пространство имен, предназначенное для хранения различных контейнеров.
+namespace Containers
+{
+    class ThreadPool;
+
+    /*  DoublyLinkedList - шаблонный класс, описывающий структуру двусвязного списка.
+        Интерфейс совпадает с LinkedList, но каждый узел хранит указатель и на предыдущий узел, поэтому:
+        - popBack() и удаление по итератору (erase) выполняются за O(1);
+        - итератор двунаправленный, доступен обратный обход (rbegin/rend);
+        - operator[] идёт к элементу от ближайшего конца списка.
+        Платой является один дополнительный указатель в каждом узле.  */
+    template <typename T>
+    class DoublyLinkedList
+    {
+    private:
+        // ListNode - cтруктура узла.
+        struct ListNode
+        {
+            // Значение, хранящееся в узле.
+            T value;
+
+            // Указатели на предыдущий и следующий узлы списка.
+            ListNode* prev;
+            ListNode* next;
+
+            ListNode(const T& value) : value(value), prev(nullptr), next(nullptr) {}
+            ListNode(T&& value) : value(std::move(value)), prev(nullptr), next(nullptr) {}
+        };
+
+        // Размер списка на текущий момент.
+        size_t sizeOfList;
+
+        // Указатель на первый узел списка.
+        ListNode* head;
+
+        // Указатель на последний узел списка.
+        ListNode* tail;
+
+        // Ресурс памяти, из которого выделяются узлы (nullptr - собственный пул узлов списка).
+        std::pmr::memory_resource* resource;
+
+        // Пул узлов (используется, если ресурс памяти не задан).
+        NodePool<ListNode> pool;
+
+        // Метод создаёт новый узел со значением value (в пуле списка либо у ресурса памяти).
+        template <typename Value>
+        ListNode* createNode(Value&& value)
+        {
+            void* memory = (resource == nullptr) ? pool.allocate() : resource->allocate(sizeof(ListNode), alignof(ListNode));
+
+            try {
+                return new (memory) ListNode(std::forward<Value>(value));
+            }
+            catch (...)
+            {
+                freeNode(memory);
+                throw;
+            }
+        }
+
+        // Метод уничтожает узел и освобождает занимаемую им память.
+        void destroyNode(ListNode* node)
+        {
+            node->~ListNode();
+            freeNode(node);
+        }
+
+        // Метод освобождает память узла (возвращает её в пул списка либо ресурсу памяти).
+        void freeNode(void* memory)
+        {
+            if (resource == nullptr)
+            {
+                pool.deallocate(memory);
+                return;
+            }
+
+            resource->deallocate(memory, sizeof(ListNode), alignof(ListNode));
+        }
+
+        // Метод присоединяет новый узел к концу списка.
+        void linkBack(ListNode* newNode)
+        {
+            newNode->prev = tail;
+
+            if (tail != nullptr) {
+                tail->next = newNode;
+            }
+            else {
+                head = newNode;
+            }
+
+            tail = newNode;
+            ++sizeOfList;
+        }
+
+        // Метод проверяет, можно ли передать узлы другого списка этому списку (совместимы ли их ресурсы памяти).
+        bool sharesResourceWith(const DoublyLinkedList<T>& other) const
+        {
+            if (resource == nullptr || other.resource == nullptr) {
+                return resource == other.resource;
+            }
+
+            return resource->is_equal(*other.resource);
+        }
+
+        // Метод восстанавливает указатели prev и хвост после перецепления узлов по полю next.
+        void relinkBackward()
+        {
+            ListNode* previous = nullptr;
+
+            for (ListNode* current = head; current != nullptr; current = current->next)
+            {
+                current->prev = previous;
+                previous = current;
+            }
+
+            tail = previous;
+        }
+
+        // Метод вырезает узел из списка и уничтожает его.
+        void unlink(ListNode* node)
+        {
+            (node->prev != nullptr ? node->prev->next : head) = node->next;
+            (node->next != nullptr ? node->next->prev : tail) = node->prev;
+
+            destroyNode(node);
+            --sizeOfList;
+        }
+
+        // Параллельная сортировка (ParallelSort.h, подключается отдельно) перецепляет узлы списка напрямую.
+        template <typename U, typename Compare>
+        friend void sortParallel(DoublyLinkedList<U>& list, Compare comparator, ThreadPool& threadPool);
+
+    public:
+        /*  Iterator - класс, описывающий структуру двунаправленного итератора.
+            Итератор end() не указывает на узел, но из него можно сделать шаг назад - к хвосту.  */
+        class Iterator
+        {
+        private:
+            // Указатель на узел, на который смотрит итератор, и список (для шага назад из end()).
+            ListNode* pointerToNode;
+            const DoublyLinkedList* list;
+
+            friend class DoublyLinkedList;
+
+        public:
+            // Информация об итераторе для библиотеки <algorithm>:
+            using iterator_category = std::bidirectional_iterator_tag; // Тип итератора.
+            using value_type = T;                                      // Тип элемента.
+            using difference_type = std::ptrdiff_t;                    // Разница между итераторами.
+            using pointer = T*;                                        // Указатель на элемент.
+            using reference = T&;                                      // Ссылка на элемент.
+
+            Iterator() : pointerToNode(nullptr), list(nullptr) {}
+            Iterator(ListNode* somePointer, const DoublyLinkedList* someList) : pointerToNode(somePointer), list(someList) {}
+
+            // Оператор разыменования - возвращает значение узла (на который смотрит итератор) по ссылке.
+            reference operator*() const {
+                return pointerToNode->value;
+            }
+
+            pointer operator->() const {
+                return &pointerToNode->value;
+            }
+
+            // Операторы инкремента - передвигают итератор на следующий узел списка.
+            Iterator& operator++()
+            {
+                pointerToNode = pointerToNode->next;
+                return *this;
+            }
+
+            Iterator operator++(int)
+            {
+                Iterator temp = *this;
+                ++(*this);
+                return temp;
+            }
+
+            // Операторы декремента - передвигают итератор на предыдущий узел списка (из end() - на хвост).
+            Iterator& operator--()
+            {
+                pointerToNode = (pointerToNode == nullptr) ? list->tail : pointerToNode->prev;
+                return *this;
+            }
+
+            Iterator operator--(int)
+            {
+                Iterator temp = *this;
+                --(*this);
+                return temp;
+            }
+
+            // Операторы сравнения - проверяют итераторы на равенство.
+            bool operator==(const Iterator& other) const {
+                return pointerToNode == other.pointerToNode;
+            }
+
+            bool operator!=(const Iterator& other) const {
+                return pointerToNode != other.pointerToNode;
+            }
+        };
+
+        // Обратный итератор (обход от хвоста к голове).
+        using ReverseIterator = std::reverse_iterator<Iterator>;
+
+        // Методы возвращают итераторы на голову списка и на позицию после хвоста.
+        Iterator begin() const {
+            return Iterator(head, this);
+        }
+
+        Iterator end() const {
+            return Iterator(nullptr, this);
+        }
+
+        // Методы возвращают обратные итераторы на хвост списка и на позицию перед головой.
+        ReverseIterator rbegin() const {
+            return ReverseIterator(end());
+        }
+
+        ReverseIterator rend() const {
+            return ReverseIterator(begin());
+        }
+
+        // Конструктор по умолчанию.
+        DoublyLinkedList() : sizeOfList(0), head(nullptr), tail(nullptr), resource(nullptr) {}
+
+        /*  Конструктор, принимающий ресурс памяти, из которого будут выделяться узлы
+            (например, арену MonotonicArena). Ресурс должен пережить список.  */
+        explicit DoublyLinkedList(std::pmr::memory_resource* memoryResource)
+            : sizeOfList(0), head(nullptr), tail(nullptr), resource(memoryResource) {}
+
+        // Пользовательский конструктор.
+        DoublyLinkedList(const std::initializer_list<T>& list) : DoublyLinkedList()
+        {
+            for (const T& value : list) {
+                this->pushBack(value);
+            }
+        }
+
+        // Конструктор глубокого копирования (узлы копии выделяются из собственного пула).
+        DoublyLinkedList(const DoublyLinkedList<T>& other) : DoublyLinkedList()
+        {
+            for (ListNode* currentOther = other.head; currentOther != nullptr; currentOther = currentOther->next) {
+                this->pushBack(currentOther->value);
+            }
+        }
+
+        // Конструктор перемещения (вместе с узлами забирается и ресурс памяти либо пул узлов).
+        DoublyLinkedList(DoublyLinkedList<T>&& other) noexcept
+            : sizeOfList(other.sizeOfList), head(other.head), tail(other.tail), resource(other.resource), pool(std::move(other.pool))
+        {
+            other.sizeOfList = 0;
+            other.head = nullptr;
+            other.tail = nullptr;
+        }
+
+        // Деструктор.
+        ~DoublyLinkedList() {
+            this->clear();
+        }
+
+        // Оператор глубокого копирования.
+        DoublyLinkedList<T>& operator=(const DoublyLinkedList<T>& other)
+        {
+            // 1. Если произошла попытка самоприсваивания - ничего не делаю.
+            if (this == &other) {
+                return *this;
+            }
+
+            // 2. Очищаю свой список и копирую в него значения другого списка.
+            this->clear();
+
+            for (ListNode* currentOther = other.head; currentOther != nullptr; currentOther = currentOther->next) {
+                this->pushBack(currentOther->value);
+            }
+
+            return *this;
+        }
+
+        // Оператор присваивания перемещением (не noexcept: при несовместимых ресурсах памяти узлы создаются заново).
+        DoublyLinkedList<T>& operator=(DoublyLinkedList<T>&& other)
+        {
+            // 1. Если произошла попытка самоприсваивания - ничего не делаю.
+            if (this == &other) {
+                return *this;
+            }
+
+            // 2. Очищаю свой список.
+            this->clear();
+
+            // 3. Если узлы другого списка выделены из несовместимого ресурса памяти - переношу значения по одному.
+            if (!sharesResourceWith(other))
+            {
+                for (ListNode* currentOther = other.head; currentOther != nullptr; currentOther = currentOther->next) {
+                    this->pushBack(std::move(currentOther->value));
+                }
+
+                other.clear();
+                return *this;
+            }
+
+            // 4. Забираю узлы и пул другого списка, а другой список оставляю пустым.
+            sizeOfList = other.sizeOfList;
+            head = other.head;
+            tail = other.tail;
+            pool = std::move(other.pool);
+
+            other.sizeOfList = 0;
+            other.head = nullptr;
+            other.tail = nullptr;
+
+            return *this;
+        }
+
+        /*
+        1.  Данный оператор предоставляет доступ к элементам списка по индексу (аналогично массивам).
+        2.  Доступна как положительная индексация (первый элемент имеет индекс 0),
+        так и отрицательная (последний элемент имеет индекс -1).
+        3.  Обход начинается с ближайшего к элементу конца списка, поэтому сложность - O(min(i, n - i)).
+        */
+        T& operator[](int index)
+        {
+            // 1. Если значение индекса выходит за пределы - выбрасываю исключение.
+            if (index < -int(sizeOfList) || index >= int(sizeOfList)) {
+                throw std::out_of_range("Error! The index is out of range.");
+            }
+
+            // 2. Привожу индекс к неотрицательному.
+            const size_t position = (index < 0) ? sizeOfList + index : size_t(index);
+
+            // 3. Иду от головы или от хвоста - смотря что ближе.
+            if (position < sizeOfList / 2)
+            {
+                ListNode* tempPtr = head;
+                for (size_t i = 0; i < position; ++i) {
+                    tempPtr = tempPtr->next;
+                }
+
+                return tempPtr->value;
+            }
+
+            ListNode* tempPtr = tail;
+            for (size_t i = sizeOfList - 1; i > position; --i) {
+                tempPtr = tempPtr->prev;
+            }
+
+            return tempPtr->value;
+        }
+
+        /*  Метод показывает, является ли список пустым.
+            Возвращает соответствующее булевое значение.  */
+        bool isEmpty() const {
+            return head == nullptr;
+        }
+
+        // Метод возвращает ресурс памяти, из которого выделяются узлы (nullptr - собственный пул узлов).
+        std::pmr::memory_resource* memoryResource() const {
+            return resource;
+        }
+
+        // Метод возвращает длину списка на текущий момент.
+        size_t size() const {
+            return sizeOfList;
+        }
+
+        // Метод возвращает значение первого узла списка по ссылке.
+        T& front() const
+        {
+            if (head == nullptr) {
+                throw std::runtime_error("Error! The list is empty - you cannot refer to the first element.");
+            }
+
+            return head->value;
+        }
+
+        // Метод возвращает значение последнего узла списка по ссылке.
+        T& back() const
+        {
+            if (head == nullptr) {
+                throw std::runtime_error("Error! The list is empty - you cannot refer to the last element.");
+            }
+
+            return tail->value;
+        }
+
+        // Метод выводит значения всех узлов в порядке их расположения в списке.
+        void print() const
+        {
+            for (ListNode* tempPtr = head; tempPtr != nullptr; tempPtr = tempPtr->next) {
+                std::cout << tempPtr->value << ' ';
+            }
+
+            std::cout << '\n';
+        }
+
+        /*  Метод ищет первый узел со значением value и возвращает указатель
+            на значение этого узла. Если узел не найден - возвращает nullptr.  */
+        T* find(const T& value) const
+        {
+            for (ListNode* tempPtr = head; tempPtr != nullptr; tempPtr = tempPtr->next)
+            {
+                if (tempPtr->value == value) {
+                    return &tempPtr->value;
+                }
+            }
+
+            return nullptr;
+        }
+
+        /*  Метод проверяет, есть ли в списке узел со значением value.
+            Возвращает соответствующее булевое значение.  */
+        bool contains(const T& value) const {
+            return find(value) != nullptr;
+        }
+
+        // Метод сортирует список по возрастанию (устойчивая сортировка слиянием за O(n log n), узлы перецепляются).
+        void sort() {
+            sort(std::less<>());
+        }
+
+        // Метод сортирует список с помощью компаратора comparator(a, b) ("a строго меньше b", без исключений).
+        template <typename Compare>
+        void sort(Compare comparator)
+        {
+            if (sizeOfList < 2) {
+                return;
+            }
+
+            head = Chain::sort(head, comparator);
+            relinkBackward();
+        }
+
+        /*  Метод сливает с текущим отсортированным списком другой отсортированный список за O(n + m);
+            после слияния другой список пуст. При равенстве первыми идут элементы текущего списка.  */
+        void merge(DoublyLinkedList<T>&& other) {
+            merge(std::move(other), std::less<>());
+        }
+
+        template <typename Compare>
+        void merge(DoublyLinkedList<T>&& other, Compare comparator)
+        {
+            // 1. Сливать список с самим собой или с пустым списком не нужно.
+            if (this == &other || other.isEmpty()) {
+                return;
+            }
+
+            // 2. Узлы из несовместимого ресурса памяти забрать нельзя - переношу значения в узлы из своего ресурса.
+            if (!sharesResourceWith(other))
+            {
+                DoublyLinkedList<T> copy(resource);
+
+                for (ListNode* currentOther = other.head; currentOther != nullptr; currentOther = currentOther->next) {
+                    copy.pushBack(std::move(currentOther->value));
+                }
+
+                other.clear();
+                merge(std::move(copy), comparator);
+                return;
+            }
+
+            // 3. Забираю блоки пула другого списка, сливаю цепочки и восстанавливаю обратные связи.
+            pool.absorb(other.pool);
+
+            head = Chain::merge(head, other.head, comparator);
+            sizeOfList += other.sizeOfList;
+            relinkBackward();
+
+            other.sizeOfList = 0;
+            other.head = nullptr;
+            other.tail = nullptr;
+        }
+
+        // Метод полностью очищает список.
+        void clear()
+        {
+            // 1. Если узлы выделены из собственного пула - уничтожаю значения и возвращаю в кучу сразу все блоки.
+            if (resource == nullptr)
+            {
+                if constexpr (!std::is_trivially_destructible<T>::value)
+                {
+                    ListNode* tempPtr = head;
+
+                    while (tempPtr != nullptr)
+                    {
+                        ListNode* next = tempPtr->next;
+                        tempPtr->~ListNode();
+                        tempPtr = next;
+                    }
+                }
+
+                sizeOfList = 0;
+                head = nullptr;
+                tail = nullptr;
+                pool.releaseAll();
+                return;
+            }
+
+            // 2. Иначе - уничтожаю узлы по одному, начиная с головы (значения не копируются).
+            while (head != nullptr)
+            {
+                ListNode* next = head->next;
+                destroyNode(head);
+                head = next;
+            }
+
+            sizeOfList = 0;
+            tail = nullptr;
+        }
+
+        /*  Метод "забывает" все узлы списка без поштучного освобождения их памяти
+            (для узлов из арены MonotonicArena). Для списка без ресурса памяти метод эквивалентен clear().  */
+        void release()
+        {
+            if (resource == nullptr)
+            {
+                clear();
+                return;
+            }
+
+            if constexpr (!std::is_trivially_destructible<T>::value)
+            {
+                ListNode* tempPtr = head;
+
+                while (tempPtr != nullptr)
+                {
+                    ListNode* next = tempPtr->next;
+                    tempPtr->~ListNode();
+                    tempPtr = next;
+                }
+            }
+
+            sizeOfList = 0;
+            head = nullptr;
+            tail = nullptr;
+        }
+
+        /*  Метод удаляет первый узел со значением valueToRemove.
+            Возвращает true, если узел с соответствующим значением был найден и удалён, иначе - false.  */
+        bool remove(const T& valueToRemove)
+        {
+            for (ListNode* tempPtr = head; tempPtr != nullptr; tempPtr = tempPtr->next)
+            {
+                if (tempPtr->value == valueToRemove)
+                {
+                    unlink(tempPtr);
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        /*  Метод удаляет все узлы со значением valueToRemove (за один проход).
+            Возвращает true, если хотя бы один узел был удалён, иначе - false. */
+        bool removeAll(const T& valueToRemove)
+        {
+            bool flag = false;
+            ListNode* tempPtr = head;
+
+            while (tempPtr != nullptr)
+            {
+                ListNode* next = tempPtr->next;
+
+                if (tempPtr->value == valueToRemove)
+                {
+                    unlink(tempPtr);
+                    flag = true;
+                }
+
+                tempPtr = next;
+            }
+
+            return flag;
+        }
+
+        /*  Метод удаляет элемент, на который смотрит итератор position, за O(1).
+            Возвращает итератор на следующий элемент.  */
+        Iterator erase(Iterator position)
+        {
+            if (position.list != this) {
+                throw std::runtime_error("Error! The iterator does not belong to this list.");
+            }
+
+            if (position.pointerToNode == nullptr) {
+                throw std::out_of_range("Error! You cannot erase the end of the list.");
+            }
+
+            ListNode* next = position.pointerToNode->next;
+            unlink(position.pointerToNode);
+
+            return Iterator(next, this);
+        }
+
+        /*  Метод вставляет значение перед элементом, на который смотрит итератор position (end() - в конец), за O(1).
+            Возвращает итератор на вставленный элемент.  */
+        Iterator insert(Iterator position, const T& value)
+        {
+            if (position.list != this) {
+                throw std::runtime_error("Error! The iterator does not belong to this list.");
+            }
+
+            ListNode* next = position.pointerToNode;
+
+            if (next == nullptr)
+            {
+                pushBack(value);
+                return Iterator(tail, this);
+            }
+
+            ListNode* newNode = createNode(value);
+
+            newNode->next = next;
+            newNode->prev = next->prev;
+            (next->prev != nullptr ? next->prev->next : head) = newNode;
+            next->prev = newNode;
+
+            ++sizeOfList;
+
+            return Iterator(newNode, this);
+        }
+
+        // Метод добавляет новый элемент в начало списка.
+        void pushFront(const T& value)
+        {
+            ListNode* newNode = createNode(value);
+
+            newNode->next = head;
+
+            if (head != nullptr) {
+                head->prev = newNode;
+            }
+            else {
+                tail = newNode;
+            }
+
+            head = newNode;
+            ++sizeOfList;
+        }
+
+        // Метод добавляет копию элемента в конец списка.
+        void pushBack(const T& value) {
+            linkBack(createNode(value));
+        }
+
+        // Метод добавляет элемент в конец списка перемещением.
+        void pushBack(T&& value) {
+            linkBack(createNode(std::move(value)));
+        }
+
+        /*  Метод удаляет первый элемент из списка.
+            Возвращает значение удаленного элемента.  */
+        T popFront()
+        {
+            if (head == nullptr) {
+                throw std::runtime_error("Error! It's not possible to delete item from empty list!");
+            }
+
+            T deleted = std::move(head->value);
+            unlink(head);
+
+            return deleted;
+        }
+
+        /*  Метод удаляет последний элемент из списка за O(1) (предыдущий узел известен из tail->prev).
+            Возвращает значение удаленного элемента.  */
+        T popBack()
+        {
+            if (head == nullptr) {
+                throw std::runtime_error("Error! It's not possible to delete item from empty list!");
+            }
+
+            T deleted = std::move(tail->value);
+            unlink(tail);
+
+            return deleted;
+        }
+    };
+}
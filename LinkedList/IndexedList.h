@@ -0,0 +1,659 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+
+// Containers - пространство имен, предназначенное для хранения различных контейнеров.
+namespace Containers
+{
+    /*  IndexedList - шаблонный класс, описывающий индексируемый список на основе списка с пропусками (skip list).
+        Нижний уровень - обычный односвязный список всех элементов, над ним лежат "экспресс-полосы": узел высоты h
+        присутствует на уровнях 0..h-1, высота выбирается случайно (каждый следующий уровень - с вероятностью 1/4).
+        Каждая ссылка хранит длину пролёта (span) - сколько позиций она перепрыгивает, поэтому спуск по полосам
+        находит элемент по индексу в среднем за O(log n): так работают operator[], insertAt и eraseAt.
+        Обход итератором идёт по нижнему уровню и стоит столько же, сколько у LinkedList.
+        Индексы имеют тип size_t, отрицательная индексация (-1 - последний элемент) тоже поддерживается.  */
+    template <typename T>
+    class IndexedList
+    {
+    private:
+        // Максимальное количество уровней (при вероятности 1/4 его хватает на любой размер списка).
+        static constexpr size_t maxLevel = 32;
+
+        struct ListNode;
+
+        // Link - ссылка узла на одном уровне: следующий узел уровня и количество позиций до него.
+        struct Link
+        {
+            ListNode* next;
+            size_t span;
+        };
+
+        /*  ListNode - cтруктура узла. Массив ссылок (по одной на каждый уровень узла) размещается в той же
+            памяти сразу после узла, поэтому узел любой высоты занимает одно выделение.  */
+        struct ListNode
+        {
+            // Значение, хранящееся в узле.
+            T value;
+
+            // Количество уровней, на которых присутствует узел.
+            size_t height;
+
+            ListNode(const T& value, size_t height) : value(value), height(height) {}
+
+            // Метод возвращает массив ссылок узла (он начинается сразу после узла).
+            Link* links() {
+                return reinterpret_cast<Link*>(reinterpret_cast<char*>(this) + linksOffset);
+            }
+        };
+
+        // Смещение массива ссылок от начала узла и выравнивание памяти узла.
+        static constexpr size_t linksOffset = (sizeof(ListNode) + alignof(Link) - 1) / alignof(Link) * alignof(Link);
+        static constexpr size_t nodeAlignment = alignof(ListNode) > alignof(Link) ? alignof(ListNode) : alignof(Link);
+
+        // Размер списка на текущий момент.
+        size_t sizeOfList;
+
+        // Количество используемых уровней (высота самого высокого узла, не меньше 1).
+        size_t level;
+
+        // Ссылки головы списка на каждом уровне (голова стоит перед первым элементом и значения не хранит).
+        Link head[maxLevel];
+
+        // Указатель на последний узел списка.
+        ListNode* tail;
+
+        // Состояние генератора высот узлов (xorshift64).
+        uint64_t randomState;
+
+        // Метод возвращает массив ссылок узла (nullptr - голова списка).
+        Link* linksOf(ListNode* node) {
+            return (node == nullptr) ? head : node->links();
+        }
+
+        // Метод выбирает высоту нового узла: каждый следующий уровень добавляется с вероятностью 1/4.
+        size_t randomHeight()
+        {
+            randomState ^= randomState << 13;
+            randomState ^= randomState >> 7;
+            randomState ^= randomState << 17;
+
+            uint64_t bits = randomState;
+            size_t height = 1;
+
+            while ((bits & 3) == 0 && height < maxLevel)
+            {
+                ++height;
+                bits >>= 2;
+            }
+
+            return height;
+        }
+
+        // Метод создаёт новый узел высоты height со значением value (ссылки не инициализируются).
+        ListNode* createNode(const T& value, size_t height)
+        {
+            void* memory = ::operator new(linksOffset + height * sizeof(Link), std::align_val_t(nodeAlignment));
+
+            try {
+                return new (memory) ListNode(value, height);
+            }
+            catch (...)
+            {
+                ::operator delete(memory, std::align_val_t(nodeAlignment));
+                throw;
+            }
+        }
+
+        // Метод уничтожает узел и освобождает занимаемую им память.
+        static void destroyNode(ListNode* node)
+        {
+            node->~ListNode();
+            ::operator delete(static_cast<void*>(node), std::align_val_t(nodeAlignment));
+        }
+
+        // Метод сбрасывает ссылки головы (список становится пустым, узлы не освобождаются).
+        void resetHead()
+        {
+            for (size_t i = 0; i < maxLevel; ++i) {
+                head[i] = Link{ nullptr, 0 };
+            }
+
+            sizeOfList = 0;
+            level = 1;
+            tail = nullptr;
+        }
+
+        /*  Метод приводит индекс к неотрицательному или выбрасывает исключение.
+            Отрицательный индекс, преобразованный к size_t, становится очень большим числом,
+            и прибавление размера списка (по модулю 2^64) возвращает его в диапазон [0, size).  */
+        size_t normalize(size_t index) const
+        {
+            if (index >= sizeOfList)
+            {
+                index += sizeOfList;
+
+                if (index >= sizeOfList) {
+                    throw std::out_of_range("Error! The index is out of range.");
+                }
+            }
+
+            return index;
+        }
+
+        /*  Метод спускается по уровням к позиции position (0 - перед первым элементом) и для каждого уровня
+            запоминает последний узел перед этой позицией (update) и его позицию в списке (rank).  */
+        void findPredecessors(size_t position, ListNode** update, size_t* rank)
+        {
+            ListNode* node = nullptr;
+            size_t traversed = 0;
+
+            for (size_t i = level; i-- > 0; )
+            {
+                Link* links = linksOf(node);
+
+                while (links[i].next != nullptr && traversed + links[i].span <= position)
+                {
+                    traversed += links[i].span;
+                    node = links[i].next;
+                    links = node->links();
+                }
+
+                update[i] = node;
+                rank[i] = traversed;
+            }
+        }
+
+        // Метод возвращает узел элемента с индексом index (индекс должен быть корректным).
+        ListNode* nodeAt(size_t index) const
+        {
+            const size_t target = index + 1;
+            const Link* links = head;
+            ListNode* node = nullptr;
+            size_t traversed = 0;
+
+            for (size_t i = level; i-- > 0; )
+            {
+                while (links[i].next != nullptr && traversed + links[i].span <= target)
+                {
+                    traversed += links[i].span;
+                    node = links[i].next;
+                    links = node->links();
+                }
+
+                if (traversed == target) {
+                    break;
+                }
+            }
+
+            return node;
+        }
+
+        // Метод вплетает оставшийся узел на новую позицию kept + 1 за предшественниками update на всех его уровнях.
+        void appendKept(ListNode* node, ListNode** update, size_t* rank, size_t& kept)
+        {
+            ++kept;
+
+            for (size_t i = 0; i < node->height; ++i)
+            {
+                linksOf(update[i])[i] = Link{ node, kept - rank[i] };
+                update[i] = node;
+                rank[i] = kept;
+            }
+        }
+
+        // Метод завершает removeAll: замыкает уровни на конце списка, убирает опустевшие уровни и освобождает узлы removed.
+        void finishRemoval(ListNode** update, size_t* rank, size_t kept, ListNode* removed)
+        {
+            for (size_t i = 0; i < level; ++i) {
+                linksOf(update[i])[i] = Link{ nullptr, kept - rank[i] };
+            }
+
+            while (level > 1 && head[level - 1].next == nullptr)
+            {
+                head[level - 1].span = 0;
+                --level;
+            }
+
+            sizeOfList = kept;
+            tail = update[0];
+
+            while (removed != nullptr)
+            {
+                ListNode* next = removed->links()[0].next;
+                destroyNode(removed);
+                removed = next;
+            }
+        }
+
+    public:
+        /*  Iterator - класс, описывающий структуру итератора
+            (объекта, с помощью которого можно итерироваться по списку).  */
+        class Iterator
+        {
+        private:
+            // Указатель на узел, на который смотрит итератор.
+            ListNode* node;
+
+        public:
+            // Информация об итераторе для библиотеки <algorithm>:
+            using iterator_category = std::forward_iterator_tag;   // Тип итератора.
+            using value_type = T;                                  // Тип элемента.
+            using difference_type = std::ptrdiff_t;                // Разница между итераторами.
+            using pointer = T*;                                    // Указатель на элемент.
+            using reference = T&;                                  // Ссылка на элемент.
+
+            Iterator(ListNode* someNode) : node(someNode) {}
+
+            // Оператор разыменования - возвращает элемент, на который смотрит итератор, по ссылке.
+            reference operator*() const {
+                return node->value;
+            }
+
+            pointer operator->() const {
+                return &node->value;
+            }
+
+            // Операторы инкремента - переход к следующему элементу по нижнему уровню.
+            Iterator& operator++()
+            {
+                node = node->links()[0].next;
+                return *this;
+            }
+
+            Iterator operator++(int)
+            {
+                Iterator temp = *this;
+                ++(*this);
+                return temp;
+            }
+
+            // Операторы сравнения - проверяют итераторы на равенство.
+            bool operator==(const Iterator& other) const {
+                return node == other.node;
+            }
+
+            bool operator!=(const Iterator& other) const {
+                return node != other.node;
+            }
+        };
+
+        // Метод возвращает итератор, который смотрит на первый элемент списка.
+        Iterator begin() const {
+            return Iterator(head[0].next);
+        }
+
+        // Метод возвращает итератор, который смотрит на элемент, следующий за последним (это всегда nullptr).
+        Iterator end() const {
+            return Iterator(nullptr);
+        }
+
+        // Конструктор по умолчанию.
+        IndexedList() : randomState(0x9E3779B97F4A7C15ull) {
+            resetHead();
+        }
+
+        // Пользовательский конструктор.
+        IndexedList(const std::initializer_list<T>& list) : IndexedList()
+        {
+            for (const T& value : list) {
+                this->pushBack(value);
+            }
+        }
+
+        // Конструктор глубокого копирования.
+        IndexedList(const IndexedList& other) : IndexedList()
+        {
+            for (const T& value : other) {
+                this->pushBack(value);
+            }
+        }
+
+        // Конструктор перемещения (узлы переходят к новому списку).
+        IndexedList(IndexedList&& other) noexcept : randomState(other.randomState)
+        {
+            resetHead();
+            *this = std::move(other);
+        }
+
+        // Деструктор.
+        ~IndexedList() {
+            this->clear();
+        }
+
+        // Оператор глубокого копирования.
+        IndexedList& operator=(const IndexedList& other)
+        {
+            if (this == &other) {
+                return *this;
+            }
+
+            this->clear();
+
+            for (const T& value : other) {
+                this->pushBack(value);
+            }
+
+            return *this;
+        }
+
+        // Оператор присваивания перемещением.
+        IndexedList& operator=(IndexedList&& other) noexcept
+        {
+            if (this == &other) {
+                return *this;
+            }
+
+            this->clear();
+
+            for (size_t i = 0; i < maxLevel; ++i) {
+                head[i] = other.head[i];
+            }
+
+            sizeOfList = other.sizeOfList;
+            level = other.level;
+            tail = other.tail;
+
+            other.resetHead();
+
+            return *this;
+        }
+
+        /*
+        1.  Данный оператор предоставляет доступ к элементам списка по индексу (аналогично массивам) за O(log n).
+        2.  Доступна как положительная индексация (первый элемент имеет индекс 0),
+        так и отрицательная (последний элемент имеет индекс -1).
+        */
+        T& operator[](size_t index) const {
+            return nodeAt(normalize(index))->value;
+        }
+
+        /*  Метод показывает, является ли список пустым.
+            Возвращает соответствующее булевое значение.  */
+        bool isEmpty() const {
+            return sizeOfList == 0;
+        }
+
+        // Метод возвращает длину списка на текущий момент.
+        size_t size() const {
+            return sizeOfList;
+        }
+
+        // Метод возвращает значение первого элемента списка по ссылке.
+        T& front() const
+        {
+            if (sizeOfList == 0) {
+                throw std::runtime_error("Error! The list is empty - you cannot refer to the first element.");
+            }
+
+            return head[0].next->value;
+        }
+
+        // Метод возвращает значение последнего элемента списка по ссылке.
+        T& back() const
+        {
+            if (sizeOfList == 0) {
+                throw std::runtime_error("Error! The list is empty - you cannot refer to the last element.");
+            }
+
+            return tail->value;
+        }
+
+        // Метод выводит значения всех элементов в порядке их расположения в списке.
+        void print() const
+        {
+            for (const T& value : *this) {
+                std::cout << value << ' ';
+            }
+
+            std::cout << '\n';
+        }
+
+        /*  Метод ищет первый элемент со значением value и возвращает указатель
+            на него. Если элемент не найден - возвращает nullptr.  */
+        T* find(const T& value) const
+        {
+            for (ListNode* node = head[0].next; node != nullptr; node = node->links()[0].next)
+            {
+                if (node->value == value) {
+                    return &node->value;
+                }
+            }
+
+            return nullptr;
+        }
+
+        /*  Метод проверяет, есть ли в списке элемент со значением value.
+            Возвращает соответствующее булевое значение.  */
+        bool contains(const T& value) const {
+            return find(value) != nullptr;
+        }
+
+        // Метод полностью очищает список.
+        void clear()
+        {
+            ListNode* node = head[0].next;
+
+            while (node != nullptr)
+            {
+                ListNode* next = node->links()[0].next;
+                destroyNode(node);
+                node = next;
+            }
+
+            resetHead();
+        }
+
+        /*  Метод вставляет значение так, чтобы оно получило индекс index (index == size() - вставка в конец).
+            Сложность - O(log n) в среднем.  */
+        void insertAt(size_t index, const T& value)
+        {
+            if (index > sizeOfList) {
+                throw std::out_of_range("Error! The index is out of range.");
+            }
+
+            // 1. Нахожу предшественников новой позиции на каждом уровне.
+            ListNode* update[maxLevel];
+            size_t rank[maxLevel];
+            findPredecessors(index, update, rank);
+
+            // 2. Создаю узел; если он выше всех - новые уровни начинаются от головы и пролетают весь список.
+            const size_t height = randomHeight();
+            ListNode* node = createNode(value, height);
+
+            for (; level < height; ++level)
+            {
+                update[level] = nullptr;
+                rank[level] = 0;
+                head[level].span = sizeOfList;
+            }
+
+            // 3. Вплетаю узел в уровни 0..height-1 и делю пролёты предшественников.
+            Link* links = node->links();
+
+            for (size_t i = 0; i < height; ++i)
+            {
+                Link& previous = linksOf(update[i])[i];
+
+                links[i].next = previous.next;
+                links[i].span = previous.span - (rank[0] - rank[i]);
+
+                previous.next = node;
+                previous.span = rank[0] - rank[i] + 1;
+            }
+
+            // 4. На более высоких уровнях пролёты над новой позицией становятся на один длиннее.
+            for (size_t i = height; i < level; ++i) {
+                ++linksOf(update[i])[i].span;
+            }
+
+            if (links[0].next == nullptr) {
+                tail = node;
+            }
+
+            ++sizeOfList;
+        }
+
+        /*  Метод удаляет элемент с индексом index (допускается отрицательный индекс) и возвращает его значение.
+            Сложность - O(log n) в среднем.  */
+        T eraseAt(size_t index)
+        {
+            index = normalize(index);
+
+            // 1. Нахожу предшественников удаляемого узла на каждом уровне.
+            ListNode* update[maxLevel];
+            size_t rank[maxLevel];
+            findPredecessors(index, update, rank);
+
+            ListNode* node = linksOf(update[0])[0].next;
+            Link* links = node->links();
+
+            // 2. Выплетаю узел: его пролёты присоединяются к пролётам предшественников, остальные укорачиваются.
+            for (size_t i = 0; i < level; ++i)
+            {
+                Link& previous = linksOf(update[i])[i];
+
+                if (previous.next == node)
+                {
+                    previous.span += links[i].span - 1;
+                    previous.next = links[i].next;
+                }
+                else {
+                    --previous.span;
+                }
+            }
+
+            // 3. Убираю опустевшие верхние уровни.
+            while (level > 1 && head[level - 1].next == nullptr)
+            {
+                head[level - 1].span = 0;
+                --level;
+            }
+
+            if (tail == node) {
+                tail = update[0];
+            }
+
+            --sizeOfList;
+
+            T deleted = std::move(node->value);
+            destroyNode(node);
+
+            return deleted;
+        }
+
+        /*  Метод удаляет первый элемент со значением valueToRemove.
+            Возвращает true, если элемент был найден и удалён, иначе - false.  */
+        bool remove(const T& valueToRemove)
+        {
+            size_t index = 0;
+
+            for (ListNode* node = head[0].next; node != nullptr; node = node->links()[0].next, ++index)
+            {
+                if (node->value == valueToRemove)
+                {
+                    eraseAt(index);
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        /*  Метод удаляет все элементы со значением valueToRemove за один проход по нижнему уровню (O(n)).
+            Совпавшие узлы выплетаются на месте, а ссылки и пролёты оставшихся узлов пересчитываются по ходу обхода.
+            Возвращает true, если хотя бы один элемент был удалён, иначе - false. */
+        bool removeAll(const T& valueToRemove)
+        {
+            // update[i] - последний оставшийся узел уровня i (nullptr - голова), rank[i] - его новая позиция.
+            ListNode* update[maxLevel];
+            size_t rank[maxLevel];
+
+            for (size_t i = 0; i < level; ++i)
+            {
+                update[i] = nullptr;
+                rank[i] = 0;
+            }
+
+            // Удалённые узлы собираются в цепочку и освобождаются после обхода: valueToRemove может лежать в одном из них.
+            ListNode* removed = nullptr;
+            ListNode* node = head[0].next;
+            ListNode* next = nullptr;
+            size_t kept = 0;
+
+            try
+            {
+                // 1. Прохожу нижний уровень: совпавший узел откладываю, остальные заново вплетаю за предшественниками.
+                for (; node != nullptr; node = next)
+                {
+                    next = node->links()[0].next;
+
+                    if (node->value == valueToRemove)
+                    {
+                        node->links()[0].next = removed;
+                        removed = node;
+                    }
+                    else {
+                        appendKept(node, update, rank, kept);
+                    }
+                }
+            }
+            catch (...)
+            {
+                // Если сравнение выбросило исключение - непроверенные узлы остаются в списке.
+                for (; node != nullptr; node = next)
+                {
+                    next = node->links()[0].next;
+                    appendKept(node, update, rank, kept);
+                }
+
+                finishRemoval(update, rank, kept, removed);
+                throw;
+            }
+
+            const bool flag = (removed != nullptr);
+
+            // 2. Замыкаю уровни, убираю опустевшие и освобождаю удалённые узлы.
+            finishRemoval(update, rank, kept, removed);
+
+            return flag;
+        }
+
+        // Метод добавляет новый элемент в начало списка.
+        void pushFront(const T& value) {
+            insertAt(0, value);
+        }
+
+        // Метод добавляет новый элемент в конец списка.
+        void pushBack(const T& value) {
+            insertAt(sizeOfList, value);
+        }
+
+        /*  Метод удаляет первый элемент из списка.
+            Возвращает значение удаленного элемента.  */
+        T popFront()
+        {
+            if (sizeOfList == 0) {
+                throw std::runtime_error("Error! It's not possible to delete item from empty list!");
+            }
+
+            return eraseAt(0);
+        }
+
+        /*  Метод удаляет последний элемент из списка.
+            Возвращает значение удаленного элемента.  */
+        T popBack()
+        {
+            if (sizeOfList == 0) {
+                throw std::runtime_error("Error! It's not possible to delete item from empty list!");
+            }
+
+            return eraseAt(sizeOfList - 1);
+        }
+    };
+}
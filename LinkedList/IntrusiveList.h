@@ -0,0 +1,404 @@
+#pragma once
+
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+// Containers - пространство имен, предназначенное для хранения различных контейнеров.
+namespace Containers
+{
+    /*  IntrusiveListHook - "крючок" для встраивания объекта в IntrusiveList.
+        Объект хранит крючок как обычное поле, и список связывает объекты через эти поля,
+        поэтому для добавления объекта в список не нужны ни выделение памяти, ни копирование.
+        Копия крючка всегда не связана: при копировании объекта его место в списке не копируется.
+        Крючок помнит свой список и свой объект, поэтому принадлежность объекта списку проверяется за O(1).
+        Важно! Объект нужно удалить из списка до его уничтожения.  */
+    class IntrusiveListHook
+    {
+    private:
+        template <typename T, IntrusiveListHook T::*Member>
+        friend class IntrusiveList;
+
+        // Указатели на крючки предыдущего и следующего объектов (nullptr - объект не находится в списке).
+        IntrusiveListHook* prev;
+        IntrusiveListHook* next;
+
+        // Список, в котором находится объект, и сам объект (запоминаются при добавлении в список).
+        const void* owner;
+        void* object;
+
+    public:
+        IntrusiveListHook() : prev(nullptr), next(nullptr), owner(nullptr), object(nullptr) {}
+
+        IntrusiveListHook(const IntrusiveListHook&) : IntrusiveListHook() {}
+
+        // Присваивание не меняет положение объекта в списке.
+        IntrusiveListHook& operator=(const IntrusiveListHook&) {
+            return *this;
+        }
+
+        /*  Метод показывает, находится ли объект в каком-либо списке.
+            Возвращает соответствующее булевое значение.  */
+        bool isLinked() const {
+            return next != nullptr;
+        }
+    };
+
+    /*  IntrusiveList - шаблонный класс, описывающий интрузивный двусвязный список.
+        Список не владеет объектами и не копирует их: он связывает сами объекты через их поле-крючок Member
+        (например, IntrusiveList<Connection, &Connection::hook>). Поэтому:
+        - добавление и удаление с обоих концов выполняются за O(1) и никогда не выделяют память;
+        - объект удаляется из середины списка за O(1) по ссылке на него (erase), без поиска;
+        - один объект может одновременно находиться в нескольких списках, если у него несколько крючков.
+        Внутри список кольцевой: фиктивный крючок root стоит между последним и первым объектами.  */
+    template <typename T, IntrusiveListHook T::*Member>
+    class IntrusiveList
+    {
+    private:
+        // Фиктивный крючок: root.next - первый объект, root.prev - последний (в пустом списке указывают на root).
+        IntrusiveListHook root;
+
+        // Размер списка на текущий момент.
+        size_t sizeOfList;
+
+        // Метод возвращает крючок объекта.
+        static IntrusiveListHook* hookOf(T& object) {
+            return &(object.*Member);
+        }
+
+        // Метод восстанавливает объект по его крючку (адрес объекта запоминается в крючке при добавлении в список).
+        static T* objectOf(IntrusiveListHook* hook) {
+            return static_cast<T*>(hook->object);
+        }
+
+        // Метод проверяет, что итератор смотрит на объект этого списка (end() допускается, если allowEnd).
+        void checkPosition(IntrusiveListHook* position, bool allowEnd) const
+        {
+            if (position == &root)
+            {
+                if (!allowEnd) {
+                    throw std::runtime_error("Error! The end() iterator does not refer to an object.");
+                }
+
+                return;
+            }
+
+            if (position->owner != this) {
+                throw std::runtime_error("Error! The iterator does not belong to this list.");
+            }
+        }
+
+        // Метод вставляет объект object перед крючком position.
+        void linkBefore(IntrusiveListHook* position, T& object)
+        {
+            IntrusiveListHook* hook = hookOf(object);
+
+            if (hook->isLinked()) {
+                throw std::runtime_error("Error! The object is already linked into a list.");
+            }
+
+            hook->owner = this;
+            hook->object = &object;
+            hook->prev = position->prev;
+            hook->next = position;
+
+            position->prev->next = hook;
+            position->prev = hook;
+
+            ++sizeOfList;
+        }
+
+        // Метод вырезает крючок из списка и отмечает его как не связанный.
+        void unlink(IntrusiveListHook* hook)
+        {
+            hook->prev->next = hook->next;
+            hook->next->prev = hook->prev;
+
+            hook->prev = nullptr;
+            hook->next = nullptr;
+            hook->owner = nullptr;
+
+            --sizeOfList;
+        }
+
+        // Метод делает список пустым (крючки объектов не меняются).
+        void resetRoot()
+        {
+            root.prev = &root;
+            root.next = &root;
+            sizeOfList = 0;
+        }
+
+    public:
+        /*  Iterator - класс, описывающий структуру итератора
+            (объекта, с помощью которого можно итерироваться по списку).  */
+        class Iterator
+        {
+        private:
+            // Указатель на крючок объекта, на который смотрит итератор (end() - фиктивный крючок).
+            IntrusiveListHook* hook;
+
+            friend class IntrusiveList;
+
+        public:
+            // Информация об итераторе для библиотеки <algorithm>:
+            using iterator_category = std::bidirectional_iterator_tag; // Тип итератора.
+            using value_type = T;                                      // Тип элемента.
+            using difference_type = std::ptrdiff_t;                    // Разница между итераторами.
+            using pointer = T*;                                        // Указатель на элемент.
+            using reference = T&;                                      // Ссылка на элемент.
+
+            Iterator(IntrusiveListHook* someHook) : hook(someHook) {}
+
+            // Оператор разыменования - возвращает объект, на который смотрит итератор, по ссылке.
+            reference operator*() const {
+                return *objectOf(hook);
+            }
+
+            pointer operator->() const {
+                return objectOf(hook);
+            }
+
+            // Операторы инкремента - переход к следующему объекту.
+            Iterator& operator++()
+            {
+                hook = hook->next;
+                return *this;
+            }
+
+            Iterator operator++(int)
+            {
+                Iterator temp = *this;
+                hook = hook->next;
+                return temp;
+            }
+
+            // Операторы декремента - переход к предыдущему объекту.
+            Iterator& operator--()
+            {
+                hook = hook->prev;
+                return *this;
+            }
+
+            Iterator operator--(int)
+            {
+                Iterator temp = *this;
+                hook = hook->prev;
+                return temp;
+            }
+
+            // Операторы сравнения - проверяют итераторы на равенство.
+            bool operator==(const Iterator& other) const {
+                return hook == other.hook;
+            }
+
+            bool operator!=(const Iterator& other) const {
+                return hook != other.hook;
+            }
+        };
+
+        // Метод возвращает итератор, который смотрит на первый объект списка.
+        Iterator begin() {
+            return Iterator(root.next);
+        }
+
+        // Метод возвращает итератор, который смотрит на позицию после последнего объекта (фиктивный крючок).
+        Iterator end() {
+            return Iterator(&root);
+        }
+
+        // Метод возвращает итератор, который смотрит на объект object (объект должен находиться в этом списке).
+        Iterator iteratorTo(T& object) {
+            return Iterator(hookOf(object));
+        }
+
+        // Конструктор по умолчанию.
+        IntrusiveList() {
+            resetRoot();
+        }
+
+        // Список не владеет объектами, поэтому копировать его нельзя.
+        IntrusiveList(const IntrusiveList&) = delete;
+        IntrusiveList& operator=(const IntrusiveList&) = delete;
+
+        // Конструктор перемещения (объекты переходят к новому списку за O(n): у каждого меняется список-владелец).
+        IntrusiveList(IntrusiveList&& other) noexcept
+        {
+            resetRoot();
+            *this = std::move(other);
+        }
+
+        // Деструктор (отвязывает все объекты, сами объекты не уничтожаются).
+        ~IntrusiveList() {
+            this->clear();
+        }
+
+        // Оператор присваивания перемещением.
+        IntrusiveList& operator=(IntrusiveList&& other) noexcept
+        {
+            if (this == &other) {
+                return *this;
+            }
+
+            this->clear();
+
+            if (other.sizeOfList != 0)
+            {
+                // Крайние объекты ссылаются на фиктивный крючок - перенаправляю их на свой.
+                root.next = other.root.next;
+                root.prev = other.root.prev;
+                root.next->prev = &root;
+                root.prev->next = &root;
+                sizeOfList = other.sizeOfList;
+
+                for (IntrusiveListHook* hook = root.next; hook != &root; hook = hook->next) {
+                    hook->owner = this;
+                }
+
+                other.resetRoot();
+            }
+
+            return *this;
+        }
+
+        /*  Метод показывает, является ли список пустым.
+            Возвращает соответствующее булевое значение.  */
+        bool isEmpty() const {
+            return sizeOfList == 0;
+        }
+
+        // Метод возвращает длину списка на текущий момент.
+        size_t size() const {
+            return sizeOfList;
+        }
+
+        // Метод возвращает первый объект списка по ссылке.
+        T& front()
+        {
+            if (sizeOfList == 0) {
+                throw std::runtime_error("Error! The list is empty - you cannot refer to the first element.");
+            }
+
+            return *objectOf(root.next);
+        }
+
+        // Метод возвращает последний объект списка по ссылке.
+        T& back()
+        {
+            if (sizeOfList == 0) {
+                throw std::runtime_error("Error! The list is empty - you cannot refer to the last element.");
+            }
+
+            return *objectOf(root.prev);
+        }
+
+        // Метод выводит все объекты в порядке их расположения в списке.
+        void print()
+        {
+            for (const T& object : *this) {
+                std::cout << object << ' ';
+            }
+
+            std::cout << '\n';
+        }
+
+        /*  Метод проверяет, находится ли объект object именно в этом списке за O(1).
+            Чтобы узнать, связан ли объект хоть с каким-то списком, достаточно (object.*Member).isLinked().  */
+        bool contains(const T& object) const {
+            return (object.*Member).owner == this;
+        }
+
+        // Метод полностью очищает список (объекты отвязываются, но не уничтожаются).
+        void clear()
+        {
+            IntrusiveListHook* hook = root.next;
+
+            while (hook != &root)
+            {
+                IntrusiveListHook* next = hook->next;
+
+                hook->prev = nullptr;
+                hook->next = nullptr;
+                hook->owner = nullptr;
+
+                hook = next;
+            }
+
+            resetRoot();
+        }
+
+        // Метод удаляет объект object из списка за O(1) (объект должен находиться в этом списке).
+        void erase(T& object)
+        {
+            IntrusiveListHook* hook = hookOf(object);
+
+            if (!hook->isLinked()) {
+                throw std::runtime_error("Error! The object is not linked into a list.");
+            }
+
+            if (hook->owner != this) {
+                throw std::runtime_error("Error! The object belongs to another list.");
+            }
+
+            unlink(hook);
+        }
+
+        // Метод удаляет объект, на который смотрит итератор, и возвращает итератор на следующий объект.
+        Iterator erase(Iterator position)
+        {
+            checkPosition(position.hook, false);
+
+            IntrusiveListHook* next = position.hook->next;
+            unlink(position.hook);
+
+            return Iterator(next);
+        }
+
+        // Метод вставляет объект object перед объектом, на который смотрит итератор (end() - вставка в конец).
+        void insert(Iterator position, T& object)
+        {
+            checkPosition(position.hook, true);
+            linkBefore(position.hook, object);
+        }
+
+        // Метод добавляет объект в начало списка.
+        void pushFront(T& object) {
+            linkBefore(root.next, object);
+        }
+
+        // Метод добавляет объект в конец списка.
+        void pushBack(T& object) {
+            linkBefore(&root, object);
+        }
+
+        /*  Метод удаляет первый объект из списка.
+            Возвращает ссылку на удаленный объект (сам объект продолжает существовать).  */
+        T& popFront()
+        {
+            if (sizeOfList == 0) {
+                throw std::runtime_error("Error! It's not possible to delete item from empty list!");
+            }
+
+            IntrusiveListHook* hook = root.next;
+            unlink(hook);
+
+            return *objectOf(hook);
+        }
+
+        /*  Метод удаляет последний объект из списка.
+            Возвращает ссылку на удаленный объект (сам объект продолжает существовать).  */
+        T& popBack()
+        {
+            if (sizeOfList == 0) {
+                throw std::runtime_error("Error! It's not possible to delete item from empty list!");
+            }
+
+            IntrusiveListHook* hook = root.prev;
+            unlink(hook);
+
+            return *objectOf(hook);
+        }
+    };
+}
@@ -1,10 +1,19 @@
 #pragma once
 
+#include <functional>
 #include <iostream>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+
+#include "NodeChain.h"
+#include "../Memory/NodePool.h"
 
 // Containers - пространство имен, предназначенное для хранения различных контейнеров.
 namespace Containers
 {
+    class ThreadPool;
+
     // LinkedList - шаблонный класс, описывающий структуру однонаправленного связанного списка.
     template <typename T>
     class LinkedList
@@ -21,6 +30,7 @@ namespace Containers
             ListNode<Type>* next;
 
             ListNode(const Type& value) : value(value), next(nullptr) {}
+            ListNode(Type&& value) : value(std::move(value)), next(nullptr) {}
         };
 
         // Размер списка на текущий момент.
@@ -32,6 +42,86 @@ namespace Containers
         // Указатель на последний узел списка.
         ListNode<T>* tail;
 
+        // Ресурс памяти, из которого выделяются узлы (nullptr - собственный пул узлов списка).
+        std::pmr::memory_resource* resource;
+
+        /*  Пул узлов (используется, если ресурс памяти не задан): узлы нарезаются из крупных блоков,
+            освобождённые узлы переиспользуются, а блоки возвращаются в кучу целиком при очистке списка.  */
+        NodePool<ListNode<T>> pool;
+
+        // Метод создаёт новый узел со значением value - копией или перемещением (в пуле списка либо у ресурса памяти).
+        template <typename Value>
+        ListNode<T>* createNode(Value&& value)
+        {
+            void* memory = (resource == nullptr) ? pool.allocate() : resource->allocate(sizeof(ListNode<T>), alignof(ListNode<T>));
+
+            try {
+                return new (memory) ListNode<T>(std::forward<Value>(value));
+            }
+            catch (...)
+            {
+                freeNode(memory);
+                throw;
+            }
+        }
+
+        // Метод уничтожает узел и освобождает занимаемую им память.
+        void destroyNode(ListNode<T>* node)
+        {
+            node->~ListNode<T>();
+            freeNode(node);
+        }
+
+        // Метод освобождает память узла (возвращает её в пул списка либо ресурсу памяти).
+        void freeNode(void* memory)
+        {
+            if (resource == nullptr) 
+            {
+                pool.deallocate(memory);
+                return;
+            }
+
+            resource->deallocate(memory, sizeof(ListNode<T>), alignof(ListNode<T>));
+        }
+
+        // Метод присоединяет новый узел к концу списка.
+        void linkBack(ListNode<T>* newNode)
+        {
+            // 1. Если список пустой - новый узел становится как головой, так и хвостом.
+            if (head == nullptr)
+            {
+                head = newNode;
+                tail = newNode;
+            }
+            else
+            {
+                // Если список не пустой:
+
+                // 2. Последний узел списка должен показывать на новый узел.
+                tail->next = newNode;
+
+                /* 2.1. Указатель на хвост должен показывать на новый узел
+                        (так как теперь новый узел - последний в списке). */
+                tail = newNode;
+            }
+
+            ++sizeOfList;
+        }
+
+        // Метод проверяет, можно ли передать узлы другого списка этому списку (совместимы ли их ресурсы памяти).
+        bool sharesResourceWith(const LinkedList<T>& other) const
+        {
+            if (resource == nullptr || other.resource == nullptr) {
+                return resource == other.resource;
+            }
+
+            return resource->is_equal(*other.resource);
+        }
+
+        // Параллельная сортировка (ParallelSort.h, подключается отдельно) перецепляет узлы списка напрямую.
+        template <typename U, typename Compare>
+        friend void sortParallel(LinkedList<U>& list, Compare comparator, ThreadPool& threadPool);
+
     public:
         /*  Iterator - класс, описывающий структуру итератора
             (объекта, с помощью которого можно итерироваться по списку).  */
@@ -85,7 +175,12 @@ namespace Containers
         }
 
         // Конструктор по умолчанию.
-        LinkedList() : sizeOfList(0), head(nullptr), tail(nullptr) {}
+        LinkedList() : sizeOfList(0), head(nullptr), tail(nullptr), resource(nullptr) {}
+
+        /*  Конструктор, принимающий ресурс памяти, из которого будут выделяться узлы
+            (например, арену MonotonicArena). Ресурс должен пережить список.  */
+        explicit LinkedList(std::pmr::memory_resource* memoryResource)
+            : sizeOfList(0), head(nullptr), tail(nullptr), resource(memoryResource) {}
 
         // Пользовательский конструктор.
         LinkedList(const std::initializer_list<T>& list) : LinkedList()
@@ -95,26 +190,13 @@ namespace Containers
             }
         }
 
-        // Конструктор глубокого копирования.
-        LinkedList(const LinkedList<T>& other)
-            : sizeOfList(other.sizeOfList), head(nullptr), tail(nullptr)
+        // Конструктор глубокого копирования (узлы копии выделяются в обычной куче).
+        LinkedList(const LinkedList<T>& other) : LinkedList()
         {
-            // 1. Если другой список пустой - инициализации выше достаточно.
-            if (other.isEmpty()) {
-                return;
-            }
+            // 1. Создаю временный указатель на узлы другого списка (для итерации по ним).
+            ListNode<T>* currentOther = other.head;
 
-            // В противном случае:
-
-            /* 2.   Создаю новый узел со значением головы другого списка.
-                    Голову и хвост текущего списка направляю на созданный узел.   */
-            head = new ListNode<T>(other.head->value);
-            tail = head;
-
-            // 3. Создаю временный указатель на узлы другого списка (для итерации по ним).
-            ListNode<T>* currentOther = other.head->next;
-
-            /* 4.   Итерируюсь по узлам другого списка, беру из них значения,
+            /* 2.   Итерируюсь по узлам другого списка, беру из них значения,
                     и с помощью метода pushBack() добавляю новые узлы c взятыми значениями в свой список.  */
             while (currentOther != nullptr)
             {
@@ -123,9 +205,9 @@ namespace Containers
             }
         }
 
-        // Конструктор копирования перемещением.
+        // Конструктор копирования перемещением (вместе с узлами забирается и ресурс памяти либо пул узлов).
         LinkedList(LinkedList<T>&& other) noexcept
-            : sizeOfList(other.sizeOfList), head(other.head), tail(other.tail)
+            : sizeOfList(other.sizeOfList), head(other.head), tail(other.tail), resource(other.resource), pool(std::move(other.pool))
         {
             // 1. С помощью списка инициализации я забираю ресурсы у объекта other.
 
@@ -157,15 +239,10 @@ namespace Containers
             // 2. Очищаю свой список с помощью метода clear() (который грамотно удаляет все узлы).
             this->clear();
 
-            /* 3.   Создаю новый узел со значением головы другого списка.
-                    Голову и хвост текущего списка направляю на созданный узел.   */
-            head = new ListNode<T>(other.head->value);
-            tail = head;
-
-            // 4. Создаю временный указатель на узлы другого списка (для итерации по ним).
-            ListNode<T>* currentOther = other.head->next;
+            // 3. Создаю временный указатель на узлы другого списка (для итерации по ним).
+            ListNode<T>* currentOther = other.head;
 
-            /* 5.   Итерируюсь по узлам другого списка, беру из них значения,
+            /* 4.   Итерируюсь по узлам другого списка, беру из них значения,
                     и с помощью метода pushBack() добавляю новые узлы c взятыми значениями в свой список.   */
             while (currentOther != nullptr)
             {
@@ -176,8 +253,9 @@ namespace Containers
             return *this;
         }
 
-        // Оператор присваивания перемещением.
-        LinkedList<T>& operator=(LinkedList<T>&& other) noexcept
+        /*  Оператор присваивания перемещением.
+            Не объявлен noexcept: при несовместимых ресурсах памяти узлы создаются заново и выделение может выбросить исключение.  */
+        LinkedList<T>& operator=(LinkedList<T>&& other)
         {
             // 1. Если произошла попытка самоприсваивания - ничего не делаю.
             if (this == &other) {
@@ -189,12 +267,25 @@ namespace Containers
             // 2. Очищаю свой список с помощью метода clear() (который грамотно удаляет все узлы).
             this->clear();
 
-            // 3. Забираю ресурсы, которыми владеет объект other. 
+            /* 3.   Если узлы другого списка выделены из несовместимого ресурса памяти - забрать их нельзя,
+                    поэтому переношу значения по одному (узлы создаются из своего ресурса).  */
+            if (!sharesResourceWith(other))
+            {
+                for (ListNode<T>* currentOther = other.head; currentOther != nullptr; currentOther = currentOther->next) {
+                    this->pushBack(std::move(currentOther->value));
+                }
+
+                other.clear();
+                return *this;
+            }
+
+            // 4. Забираю ресурсы, которыми владеет объект other (свой пул после clear() пуст). 
             sizeOfList = other.sizeOfList;
             head = other.head;
             tail = other.tail;
+            pool = std::move(other.pool);
 
-            /* 4.   Для объекта other я обнуляю размер списка, указатели на голову и хвост.
+            /* 5.   Для объекта other я обнуляю размер списка, указатели на голову и хвост.
                     Благодаря данным манипуляциям, деструктор объекта other не сможет освободить
                     занимаемые им ресурсы (см. реализацию деструктора).
 
@@ -237,6 +328,11 @@ namespace Containers
             return head == nullptr;
         }
 
+        // Метод возвращает ресурс памяти, из которого выделяются узлы (nullptr - обычная куча).
+        std::pmr::memory_resource* memoryResource() const {
+            return resource;
+        }
+
         // Метод возвращает длину списка на текущий момент.
         size_t size() const {
             return sizeOfList;
@@ -302,48 +398,135 @@ namespace Containers
             return find(value) != nullptr;
         }
 
-        /*  Метод сортирует список, используя пузырьковую сортировку.
-            Важно! Данный алгоритм имеет сложность O(n^2), что может быть неэффективно для больших списков.  */
-        void sort()
+        /*  Метод сортирует список по возрастанию (устойчиво - равные элементы сохраняют взаимный порядок).
+            Используется восходящая сортировка слиянием со сложностью O(n log n): узлы перецепляются,
+            а значения не копируются и не перемещаются.  */
+        void sort() {
+            sort(std::less<>());
+        }
+
+        /*  Метод сортирует список с помощью компаратора comparator(a, b) ("a строго меньше b").
+            Важно! Компаратор не должен выбрасывать исключений.  */
+        template <typename Compare>
+        void sort(Compare comparator)
         {
             // 1. Если в списке меньше 2-х элементов - сортировать ничего не нужно.
             if (sizeOfList < 2) {
                 return;
             }
 
-            // Длина списка как минимум 1.
-            bool isSwapped = false;
+            // 2. Сортирую цепочку узлов и нахожу новый хвост.
+            head = Chain::sort(head, comparator);
+            tail = Chain::last(head);
+        }
+
+        /*  Метод сливает с текущим отсортированным списком другой отсортированный список за O(n + m).
+            Узлы другого списка перецепляются (либо их значения переносятся, если узлы выделены из несовместимого
+            ресурса памяти), после слияния другой список пуст. При равенстве первыми идут элементы текущего списка.  */
+        void merge(LinkedList<T>&& other) {
+            merge(std::move(other), std::less<>());
+        }
+
+        template <typename Compare>
+        void merge(LinkedList<T>&& other, Compare comparator)
+        {
+            // 1. Сливать список с самим собой или с пустым списком не нужно.
+            if (this == &other || other.isEmpty()) {
+                return;
+            }
 
-            // 2. Сортирую список.
-            do
+            // 2. Узлы из несовместимого ресурса памяти забрать нельзя - переношу значения в узлы из своего ресурса.
+            if (!sharesResourceWith(other))
             {
-                isSwapped = false;
-                ListNode<T>* current = head;
+                LinkedList<T> copy(resource);
+
+                for (ListNode<T>* currentOther = other.head; currentOther != nullptr; currentOther = currentOther->next) {
+                    copy.pushBack(std::move(currentOther->value));
+                }
+
+                other.clear();
+                merge(std::move(copy), comparator);
+                return;
+            }
+
+            /* 3.   Новый хвост - последний элемент того списка, который закончится позже
+                    (при равенстве последних элементов позже заканчивается другой список).  */
+            ListNode<T>* newTail = (tail != nullptr && comparator(other.tail->value, tail->value)) ? tail : other.tail;
+
+            // 4. Забираю блоки пула другого списка (в них лежат перецепляемые узлы) и сливаю цепочки.
+            pool.absorb(other.pool);
+
+            head = Chain::merge(head, other.head, comparator);
+            tail = newTail;
+            sizeOfList += other.sizeOfList;
 
-                while (current->next)
+            other.sizeOfList = 0;
+            other.head = nullptr;
+            other.tail = nullptr;
+        }
+
+        // Метод полностью очищает список.
+        void clear()
+        {
+            /*  - Если узлы выделены из собственного пула - уничтожаю значения и возвращаю в кучу
+                сразу все блоки пула (вместо n отдельных освобождений).  */
+            if (resource == nullptr)
+            {
+                if constexpr (!std::is_trivially_destructible<T>::value)
                 {
-                    if (current->value > current->next->value)
+                    ListNode<T>* tempPtr = head;
+
+                    while (tempPtr != nullptr)
                     {
-                        std::swap(current->value, current->next->value);
-                        isSwapped = true;
+                        ListNode<T>* next = tempPtr->next;
+                        tempPtr->~ListNode<T>();
+                        tempPtr = next;
                     }
-
-                    current = current->next;
                 }
 
-            } while (isSwapped);
+                sizeOfList = 0;
+                head = nullptr;
+                tail = nullptr;
+                pool.releaseAll();
+                return;
+            }
+
+            /*  - Иначе уничтожаю узлы по одному, начиная с головы, и возвращаю их память ресурсу.
+                - Значения не копируются (в отличие от popFront(), который возвращает значение).  */
+            while (head != nullptr)
+            {
+                ListNode<T>* next = head->next;
+                destroyNode(head);
+                head = next;
+            }
+
+            sizeOfList = 0;
+            tail = nullptr;
         }
 
-        // Метод полностью очищает список.
-        void clear()
+        /*  Метод "забывает" все узлы списка без поштучного освобождения их памяти.
+            Предназначен для списков, узлы которых выделены из арены (MonotonicArena):
+            память вернётся при сбросе арены, поэтому для типов с тривиальным деструктором
+            список очищается за O(1). Для списка без ресурса памяти метод эквивалентен clear().  */
+        void release()
         {
-            /*  - Пока список не пустой -> циклично удаляю первый узел.
-                - Стоит отметить, что я использую именно метод popFront(), т.к. он удаляет
-                узел со сложностью O(1). Если бы я использовал метод popBack(), сложность удаления
-                одного узла возрасла бы до O(n) - что неээфективно.  */
-            while (!isEmpty()) {
-                popFront();
+            if (resource == nullptr)
+            {
+                clear();
+                return;
             }
+
+            // Деструкторы значений всё же вызываю, если они что-то делают.
+            if constexpr (!std::is_trivially_destructible<T>::value)
+            {
+                for (ListNode<T>* tempPtr = head; tempPtr != nullptr; tempPtr = tempPtr->next) {
+                    tempPtr->~ListNode<T>();
+                }
+            }
+
+            sizeOfList = 0;
+            head = nullptr;
+            tail = nullptr;
         }
 
         /*  Метод удаляет первый узел со значением valueToRemove.
@@ -400,7 +583,7 @@ namespace Containers
             tempPtr->next = nodeToRemove->next;
 
             // 8. Удаляю узел со значением valueToRemove.
-            delete nodeToRemove;
+            destroyNode(nodeToRemove);
 
             // 9. Если я удалил последний узел, то необходимо обновить хвост.
             if (tempPtr->next == nullptr) {
@@ -431,7 +614,7 @@ namespace Containers
         void pushFront(const T& value)
         {
             // 1. Создаю новый узел и получаю на него указатель.
-            ListNode<T>* newNode = new ListNode<T>(value);
+            ListNode<T>* newNode = createNode(value);
 
             // 2. Новый узел должен показывать на первый узел списка.
             newNode->next = head;
@@ -447,31 +630,14 @@ namespace Containers
             ++sizeOfList;
         }
 
-        // Метод добавляет новый элемент в конец списка.
-        void pushBack(const T& value)
-        {
-            // 1. Создаю новый узел и получаю на него указатель.
-            ListNode<T>* newNode = new ListNode<T>(value);
-
-            // 2. Если список пустой - новый узел становится как головой, так и хвостом.
-            if (head == nullptr)
-            {
-                head = newNode;
-                tail = newNode;
-            }
-            else
-            {
-                // Если список не пустой:
-
-                // 3. Последний узел списка должен показывать на новый узел.
-                tail->next = newNode;
-
-                /* 3.1. Указатель на хвост должен показывать на новый узел
-                        (так как теперь новый узел - последний в списке). */
-                tail = newNode;
-            }
+        // Метод добавляет копию элемента в конец списка.
+        void pushBack(const T& value) {
+            linkBack(createNode(value));
+        }
 
-            ++sizeOfList;
+        // Метод добавляет элемент в конец списка перемещением.
+        void pushBack(T&& value) {
+            linkBack(createNode(std::move(value)));
         }
 
         /*  Метод удаляет первый элемент из списка.
@@ -491,7 +657,7 @@ namespace Containers
             ListNode<T>* second = head->next;
 
             // 4. Удаляю первый узел.
-            delete head;
+            destroyNode(head);
 
             // 5. Направляю указатель на голову на второй узел.
             head = second;
@@ -526,7 +692,7 @@ namespace Containers
                 deleted = head->value;
 
                 // 3.2. Удаляю узел и обнуляю указатели.
-                delete head;
+                destroyNode(head);
                 head = nullptr;
                 tail = nullptr;
             }
@@ -546,7 +712,7 @@ namespace Containers
                 deleted = tail->value;
 
                 // 4.3. Удаляю последний узел.
-                delete tail;
+                destroyNode(tail);
 
                 // 4.4. Обновляю указатель на хвост и обнуляю указатель хвоста.
                 tail = tempPtr;
@@ -0,0 +1,113 @@
+#pragma once
+#include <cstddef>
+
+// Пространство имен Containers предназначено для хранения различных контейнеров.
+namespace Containers
+{
+    /* Chain - пространство имен с алгоритмами над цепочками узлов списков.
+       Цепочка - последовательность узлов, связанных полем next и оканчивающаяся nullptr; значение узла - поле value.
+       Алгоритмы только перецепляют узлы (поле next) и никогда не копируют и не перемещают значения;
+       поле prev двусвязного списка восстанавливает сам список. Компаратор не должен выбрасывать исключений. */
+    namespace Chain
+    {
+        template<typename Node>
+        Node* last(Node* chain);                                                // Последний узел цепочки (nullptr для пустой).
+
+        template<typename Node, typename Compare>
+        Node* merge(Node* first, Node* second, Compare& comparator);            // Слияние отсортированных цепочек (устойчивое).
+
+        template<typename Node, typename Compare>
+        Node* sort(Node* chain, Compare& comparator);                           // Устойчивая сортировка слиянием за O(n log n).
+
+        // Параллельная сортировка цепочки (sortParallel) находится в ParallelSort.h, чтобы списки не зависели от ThreadPool.
+
+    } // namespace Chain.
+
+} // namespace Containers.
+
+
+
+/* ... ОПРЕДЕЛЕНИЕ ФУНКЦИОНАЛЬНОСТИ ... */
+namespace Containers
+{
+    namespace Chain
+    {
+
+        template<typename Node>
+        Node* last(Node* chain)
+        {
+            while (chain != nullptr && chain->next != nullptr) {
+                chain = chain->next;
+            }
+
+            return chain;
+        }
+
+        template<typename Node, typename Compare>
+        Node* merge(Node* first, Node* second, Compare& comparator)
+        {
+            Node*  result = nullptr;
+            Node** link   = &result;
+
+            // При равенстве первым идёт узел из first - так слияние сохраняет порядок равных элементов.
+            while (first != nullptr && second != nullptr)
+            {
+                if (comparator(second->value, first->value))
+                {
+                    *link = second;
+                    second = second->next;
+                }
+                else
+                {
+                    *link = first;
+                    first = first->next;
+                }
+
+                link = &(*link)->next;
+            }
+
+            *link = (first != nullptr) ? first : second;
+
+            return result;
+        }
+
+        template<typename Node, typename Compare>
+        Node* sort(Node* chain, Compare& comparator)
+        {
+            /* Восходящая сортировка слиянием: bins[i] - уже отсортированная цепочка из 2^i узлов (или пустая).
+               Каждый следующий узел сливается с заполненными ячейками, как при сложении двоичных чисел.
+               Дополнительная память - O(1) (64 указателя). */
+            Node*  bins[64] = {};
+            size_t usedBins = 0;
+
+            while (chain != nullptr)
+            {
+                Node* carry = chain;
+                chain = chain->next;
+                carry->next = nullptr;
+
+                // Ячейки содержат более ранние узлы, поэтому при слиянии идут первыми (устойчивость).
+                size_t i = 0;
+                for (; i < usedBins && bins[i] != nullptr; ++i)
+                {
+                    carry = merge(bins[i], carry, comparator);
+                    bins[i] = nullptr;
+                }
+
+                if (i == usedBins) { ++usedBins; }
+                bins[i] = carry;
+            }
+
+            // Сливаю ячейки: старшие ячейки содержат более ранние узлы.
+            Node* result = nullptr;
+
+            for (size_t i = 0; i < usedBins; ++i) {
+                result = merge(bins[i], result, comparator);
+            }
+
+            return result;
+        }
+
+    } // namespace Chain.
+
+} // namespace Containers.
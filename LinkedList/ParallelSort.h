@@ -0,0 +1,153 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <vector>
+#include "NodeChain.h"
+#include "LinkedList.h"
+#include "DoublyLinkedList.h"
+#include "../Parallel/ThreadPool.h"
+
+// Пространство имен Containers предназначено для хранения различных контейнеров.
+namespace Containers
+{
+    /* Параллельная сортировка списков в задачах ThreadPool.
+       Вынесена в отдельный заголовок, чтобы LinkedList.h и DoublyLinkedList.h не тянули за собой
+       пул потоков и <thread>: её подключает только тот, кому она нужна.
+       Список разрезается на отрезки по числу потоков пула, отрезки сортируются в задачах пула,
+       а затем попарно сливаются (тоже в задачах). Сортировка устойчива, значения не копируются. */
+    namespace Chain
+    {
+        /* === Размер цепочки, начиная с которого sortParallel сортирует в нескольких потоках: === */
+        constexpr size_t parallelThreshold = size_t(1) << 15;
+
+
+        template<typename Node, typename Compare>
+        Node* sortParallel(Node* chain, size_t length, Compare comparator, ThreadPool& pool); // Параллельная устойчивая сортировка.
+
+    } // namespace Chain.
+
+
+    /* === Сортировка списков (короткие списки - меньше Chain::parallelThreshold узлов - сортируются в текущем потоке): === */
+    template<typename T, typename Compare>
+    void sortParallel(LinkedList<T>& list, Compare comparator, ThreadPool& threadPool);         // С компаратором в заданном пуле.
+
+    template<typename T, typename Compare>
+    void sortParallel(LinkedList<T>& list, Compare comparator);                                 // С компаратором в общем пуле.
+
+    template<typename T>
+    void sortParallel(LinkedList<T>& list);                                                     // По возрастанию в общем пуле.
+
+    template<typename T, typename Compare>
+    void sortParallel(DoublyLinkedList<T>& list, Compare comparator, ThreadPool& threadPool);   // С компаратором в заданном пуле.
+
+    template<typename T, typename Compare>
+    void sortParallel(DoublyLinkedList<T>& list, Compare comparator);                           // С компаратором в общем пуле.
+
+    template<typename T>
+    void sortParallel(DoublyLinkedList<T>& list);                                               // По возрастанию в общем пуле.
+
+} // namespace Containers.
+
+
+
+/* ... ОПРЕДЕЛЕНИЕ ФУНКЦИОНАЛЬНОСТИ ... */
+namespace Containers
+{
+    namespace Chain
+    {
+
+        template<typename Node, typename Compare>
+        Node* sortParallel(Node* chain, size_t length, Compare comparator, ThreadPool& pool)
+        {
+            const size_t parts = std::min(pool.threadCount(), length / 2);
+
+            // 1. Для коротких цепочек или пула из одного потока параллелизм не окупается.
+            if (length < parallelThreshold || parts < 2) {
+                return sort(chain, comparator);
+            }
+
+            // 2. Разрезаю цепочку на parts отрезков почти одинаковой длины.
+            std::vector<Node*> runs(parts);
+
+            for (size_t part = 0; part < parts; ++part)
+            {
+                const size_t runLength = length / parts + (part < length % parts);
+                runs[part] = chain;
+
+                for (size_t i = 1; i < runLength; ++i) {
+                    chain = chain->next;
+                }
+
+                Node* next = chain->next;
+                chain->next = nullptr;
+                chain = next;
+            }
+
+            // 3. Сортирую отрезки в задачах пула (каждая задача - со своей копией компаратора).
+            {
+                ThreadPool::TaskGroup group(pool);
+
+                for (size_t part = 0; part < parts; ++part) {
+                    group.run([&runs, part, comparator]() mutable { runs[part] = sort(runs[part], comparator); });
+                }
+
+                group.wait();
+            }
+
+            // 4. Попарно сливаю отрезки (левый отрезок пары идёт первым - сортировка остаётся устойчивой).
+            for (size_t width = 1; width < parts; width *= 2)
+            {
+                ThreadPool::TaskGroup group(pool);
+
+                for (size_t part = 0; part + width < parts; part += 2 * width) {
+                    group.run([&runs, part, width, comparator]() mutable { runs[part] = merge(runs[part], runs[part + width], comparator); });
+                }
+
+                group.wait();
+            }
+
+            return runs[0];
+        }
+
+    } // namespace Chain.
+
+
+    /* === Сортировка LinkedList: === */
+    template<typename T, typename Compare>
+    void sortParallel(LinkedList<T>& list, Compare comparator, ThreadPool& threadPool)
+    {
+        if (list.sizeOfList < 2) {
+            return;
+        }
+
+        list.head = Chain::sortParallel(list.head, list.sizeOfList, comparator, threadPool);
+        list.tail = Chain::last(list.head);
+    }
+
+    template<typename T, typename Compare>
+    void sortParallel(LinkedList<T>& list, Compare comparator) { sortParallel(list, comparator, ThreadPool::global()); }
+
+    template<typename T>
+    void sortParallel(LinkedList<T>& list) { sortParallel(list, std::less<>(), ThreadPool::global()); }
+
+
+    /* === Сортировка DoublyLinkedList: === */
+    template<typename T, typename Compare>
+    void sortParallel(DoublyLinkedList<T>& list, Compare comparator, ThreadPool& threadPool)
+    {
+        if (list.sizeOfList < 2) {
+            return;
+        }
+
+        list.head = Chain::sortParallel(list.head, list.sizeOfList, comparator, threadPool);
+        list.relinkBackward();
+    }
+
+    template<typename T, typename Compare>
+    void sortParallel(DoublyLinkedList<T>& list, Compare comparator) { sortParallel(list, comparator, ThreadPool::global()); }
+
+    template<typename T>
+    void sortParallel(DoublyLinkedList<T>& list) { sortParallel(list, std::less<>(), ThreadPool::global()); }
+
+} // namespace Containers.
@@ -0,0 +1,699 @@
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "../Memory/NodePool.h"
+
+// Containers - пространство имен, предназначенное для хранения различных контейнеров.
+namespace Containers
+{
+    /*  UnrolledLinkedList - шаблонный класс, описывающий развёрнутый связанный список.
+        Каждый узел (фрагмент) хранит не одно значение, а небольшой массив значений и занимает около ChunkBytes байт
+        (по умолчанию - две кеш-линии). Поэтому при обходе промах кеша приходится на фрагмент, а не на каждый
+        элемент, а указатели занимают малую долю памяти. Вставка и удаление в середине по-прежнему дешёвые:
+        сдвигаются лишь элементы одного фрагмента. Переполненный фрагмент делится пополам, а фрагмент,
+        заполненный меньше чем наполовину, сливается с соседним, если их элементы помещаются в один фрагмент.
+        Интерфейс совпадает с LinkedList.  */
+    template <typename T, size_t ChunkBytes = 128>
+    class UnrolledLinkedList
+    {
+    private:
+        // Размер служебной части фрагмента (указатели на соседей и количество элементов).
+        static constexpr size_t headerBytes = 2 * sizeof(void*) + sizeof(size_t);
+
+    public:
+        // Количество элементов в одном фрагменте (не меньше одного).
+        static constexpr size_t chunkCapacity = (ChunkBytes > headerBytes + sizeof(T)) ? (ChunkBytes - headerBytes) / sizeof(T) : 1;
+
+    private:
+        /*  Chunk - cтруктура фрагмента (узла списка).
+            Фрагмент выровнен по строке кэша (64 байта): NodePool выделяет блоки с выравниванием alignof(Chunk),
+            а размер фрагмента кратен 64, поэтому каждый фрагмент начинается с новой строки кэша и не делит её
+            с соседним. Если ChunkBytes не кратен 64, фрагмент дополняется до ближайшего кратного размера.  */
+        struct alignas(64) Chunk
+        {
+            // Указатели на предыдущий и следующий фрагменты.
+            Chunk* prev;
+            Chunk* next;
+
+            // Количество элементов во фрагменте (они занимают начало массива storage).
+            size_t count;
+
+            // "Сырая" память под элементы (элементы создаются и уничтожаются списком).
+            alignas(T) unsigned char storage[chunkCapacity * sizeof(T)];
+
+            T* values() {
+                return reinterpret_cast<T*>(storage);
+            }
+        };
+
+        // Размер списка на текущий момент.
+        size_t sizeOfList;
+
+        // Указатели на первый и последний фрагменты списка.
+        Chunk* head;
+        Chunk* tail;
+
+        // Пул фрагментов: фрагменты нарезаются из крупных блоков и переиспользуются после освобождения.
+        NodePool<Chunk> pool;
+
+        // Метод создаёт пустой фрагмент и вставляет его после фрагмента after (nullptr - в начало списка).
+        Chunk* createChunkAfter(Chunk* after)
+        {
+            Chunk* chunk = static_cast<Chunk*>(pool.allocate());
+
+            chunk->count = 0;
+            chunk->prev = after;
+            chunk->next = (after != nullptr) ? after->next : head;
+
+            (chunk->next != nullptr ? chunk->next->prev : tail) = chunk;
+            (after != nullptr ? after->next : head) = chunk;
+
+            return chunk;
+        }
+
+        // Метод вырезает пустой фрагмент из списка и возвращает его память в пул.
+        void destroyChunk(Chunk* chunk)
+        {
+            (chunk->prev != nullptr ? chunk->prev->next : head) = chunk->next;
+            (chunk->next != nullptr ? chunk->next->prev : tail) = chunk->prev;
+
+            pool.deallocate(chunk);
+        }
+
+        // Метод переносит count элементов из source в destination (диапазоны могут перекрываться).
+        static void relocate(T* source, T* destination, size_t count)
+        {
+            if (count == 0 || source == destination) {
+                return;
+            }
+
+            if constexpr (std::is_trivially_copyable<T>::value) {
+                std::memmove(static_cast<void*>(destination), static_cast<const void*>(source), count * sizeof(T));
+            }
+            else if (destination < source)
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    new (destination + i) T(std::move(source[i]));
+                    source[i].~T();
+                }
+            }
+            else
+            {
+                for (size_t i = count; i-- > 0; )
+                {
+                    new (destination + i) T(std::move(source[i]));
+                    source[i].~T();
+                }
+            }
+        }
+
+        /*  Метод вставляет значение в позицию position фрагмента, в котором есть свободное место.
+            Значение принимается уже скопированным: исходный объект мог лежать в сдвигаемой части списка.  */
+        void insertIntoChunk(Chunk* chunk, size_t position, T&& value)
+        {
+            T* values = chunk->values();
+
+            relocate(values + position, values + position + 1, chunk->count - position);
+            new (values + position) T(std::move(value));
+
+            ++chunk->count;
+            ++sizeOfList;
+        }
+
+        // Метод делит заполненный фрагмент пополам и возвращает новый фрагмент (со второй половиной элементов).
+        Chunk* splitChunk(Chunk* chunk)
+        {
+            Chunk* second = createChunkAfter(chunk);
+            const size_t keep = chunk->count / 2;
+
+            relocate(chunk->values() + keep, second->values(), chunk->count - keep);
+            second->count = chunk->count - keep;
+            chunk->count = keep;
+
+            return second;
+        }
+
+        /*  Метод удаляет элемент в позиции position фрагмента. Пустой фрагмент удаляется,
+            а заполненный меньше чем наполовину - сливается со следующим, если их элементы умещаются в один фрагмент.  */
+        void eraseFromChunk(Chunk* chunk, size_t position)
+        {
+            T* values = chunk->values();
+
+            values[position].~T();
+            relocate(values + position + 1, values + position, chunk->count - position - 1);
+
+            --chunk->count;
+            --sizeOfList;
+
+            if (chunk->count == 0)
+            {
+                destroyChunk(chunk);
+                return;
+            }
+
+            Chunk* next = chunk->next;
+
+            if (next != nullptr && chunk->count < chunkCapacity / 2 && chunk->count + next->count <= chunkCapacity)
+            {
+                relocate(next->values(), values + chunk->count, next->count);
+                chunk->count += next->count;
+                next->count = 0;
+
+                destroyChunk(next);
+            }
+        }
+
+        /*  Метод удаляет из фрагмента все элементы со значением value за один проход, сдвигая оставшиеся к началу.
+            Если сравнение выбросит исключение, непроверенные элементы сдвигаются вслед за оставленными -
+            фрагмент остаётся целым.  */
+        void compactChunk(Chunk* chunk, const T& value)
+        {
+            T* values = chunk->values();
+            size_t kept = 0;
+            size_t i = 0;
+
+            try
+            {
+                for (; i < chunk->count; ++i)
+                {
+                    if (values[i] == value) {
+                        values[i].~T();
+                    }
+                    else {
+                        relocate(values + i, values + kept++, 1);
+                    }
+                }
+            }
+            catch (...)
+            {
+                relocate(values + i, values + kept, chunk->count - i);
+                sizeOfList -= i - kept;
+                chunk->count -= i - kept;
+                throw;
+            }
+
+            sizeOfList -= chunk->count - kept;
+            chunk->count = kept;
+        }
+
+        // Метод находит фрагмент, содержащий элемент с индексом index, и позицию элемента в нём (обход с ближайшего конца).
+        Chunk* locate(size_t index, size_t& position) const
+        {
+            if (index < sizeOfList / 2)
+            {
+                Chunk* chunk = head;
+
+                while (index >= chunk->count)
+                {
+                    index -= chunk->count;
+                    chunk = chunk->next;
+                }
+
+                position = index;
+                return chunk;
+            }
+
+            // Количество элементов от конца списка, считая искомый.
+            size_t fromEnd = sizeOfList - index;
+            Chunk* chunk = tail;
+
+            while (fromEnd > chunk->count)
+            {
+                fromEnd -= chunk->count;
+                chunk = chunk->prev;
+            }
+
+            position = chunk->count - fromEnd;
+            return chunk;
+        }
+
+        // Метод ищет первый элемент со значением value (возвращает фрагмент и позицию; nullptr, если не найден).
+        Chunk* locateValue(const T& value, size_t& position) const
+        {
+            for (Chunk* chunk = head; chunk != nullptr; chunk = chunk->next)
+            {
+                T* values = chunk->values();
+
+                for (size_t i = 0; i < chunk->count; ++i)
+                {
+                    if (values[i] == value)
+                    {
+                        position = i;
+                        return chunk;
+                    }
+                }
+            }
+
+            return nullptr;
+        }
+
+    public:
+        /*  Iterator - класс, описывающий структуру итератора
+            (объекта, с помощью которого можно итерироваться по списку).  */
+        class Iterator
+        {
+        private:
+            // Фрагмент, на элемент которого смотрит итератор, и позиция элемента во фрагменте.
+            Chunk* chunk;
+            size_t position;
+
+        public:
+            // Информация об итераторе для библиотеки <algorithm>:
+            using iterator_category = std::forward_iterator_tag;   // Тип итератора.
+            using value_type = T;                                  // Тип элемента.
+            using difference_type = std::ptrdiff_t;                // Разница между итераторами.
+            using pointer = T*;                                    // Указатель на элемент.
+            using reference = T&;                                  // Ссылка на элемент.
+
+            Iterator(Chunk* someChunk, size_t somePosition) : chunk(someChunk), position(somePosition) {}
+
+            // Оператор разыменования - возвращает элемент, на который смотрит итератор, по ссылке.
+            reference operator*() const {
+                return chunk->values()[position];
+            }
+
+            pointer operator->() const {
+                return chunk->values() + position;
+            }
+
+            // Операторы инкремента - переход к следующему элементу (в конце фрагмента - к следующему фрагменту).
+            Iterator& operator++()
+            {
+                if (++position == chunk->count)
+                {
+                    chunk = chunk->next;
+                    position = 0;
+                }
+
+                return *this;
+            }
+
+            Iterator operator++(int)
+            {
+                Iterator temp = *this;
+                ++(*this);
+                return temp;
+            }
+
+            // Операторы сравнения - проверяют итераторы на равенство.
+            bool operator==(const Iterator& other) const {
+                return chunk == other.chunk && position == other.position;
+            }
+
+            bool operator!=(const Iterator& other) const {
+                return !(*this == other);
+            }
+        };
+
+        // Метод возвращает итератор, который смотрит на первый элемент списка.
+        Iterator begin() const {
+            return Iterator(head, 0);
+        }
+
+        // Метод возвращает итератор, который смотрит на позицию после последнего элемента.
+        Iterator end() const {
+            return Iterator(nullptr, 0);
+        }
+
+        // Конструктор по умолчанию.
+        UnrolledLinkedList() : sizeOfList(0), head(nullptr), tail(nullptr) {}
+
+        // Пользовательский конструктор.
+        UnrolledLinkedList(const std::initializer_list<T>& list) : UnrolledLinkedList()
+        {
+            for (const T& value : list) {
+                this->pushBack(value);
+            }
+        }
+
+        // Конструктор глубокого копирования.
+        UnrolledLinkedList(const UnrolledLinkedList& other) : UnrolledLinkedList()
+        {
+            for (const T& value : other) {
+                this->pushBack(value);
+            }
+        }
+
+        // Конструктор перемещения (вместе с фрагментами забирается и пул).
+        UnrolledLinkedList(UnrolledLinkedList&& other) noexcept
+            : sizeOfList(other.sizeOfList), head(other.head), tail(other.tail), pool(std::move(other.pool))
+        {
+            other.sizeOfList = 0;
+            other.head = nullptr;
+            other.tail = nullptr;
+        }
+
+        // Деструктор.
+        ~UnrolledLinkedList() {
+            this->clear();
+        }
+
+        // Оператор глубокого копирования.
+        UnrolledLinkedList& operator=(const UnrolledLinkedList& other)
+        {
+            if (this == &other) {
+                return *this;
+            }
+
+            this->clear();
+
+            for (const T& value : other) {
+                this->pushBack(value);
+            }
+
+            return *this;
+        }
+
+        // Оператор присваивания перемещением.
+        UnrolledLinkedList& operator=(UnrolledLinkedList&& other) noexcept
+        {
+            if (this == &other) {
+                return *this;
+            }
+
+            this->clear();
+
+            sizeOfList = other.sizeOfList;
+            head = other.head;
+            tail = other.tail;
+            pool = std::move(other.pool);
+
+            other.sizeOfList = 0;
+            other.head = nullptr;
+            other.tail = nullptr;
+
+            return *this;
+        }
+
+        /*
+        1.  Данный оператор предоставляет доступ к элементам списка по индексу (аналогично массивам).
+        2.  Доступна как положительная индексация (первый элемент имеет индекс 0),
+        так и отрицательная (последний элемент имеет индекс -1).
+        3.  Обход идёт по фрагментам с ближайшего конца списка, поэтому сложность - O(n / chunkCapacity).
+        */
+        T& operator[](int index)
+        {
+            // 1. Если значение индекса выходит за пределы - выбрасываю исключение.
+            if (index < -int(sizeOfList) || index >= int(sizeOfList)) {
+                throw std::out_of_range("Error! The index is out of range.");
+            }
+
+            // 2. Нахожу фрагмент и позицию в нём.
+            size_t position = 0;
+            Chunk* chunk = locate((index < 0) ? sizeOfList + index : size_t(index), position);
+
+            return chunk->values()[position];
+        }
+
+        /*  Метод показывает, является ли список пустым.
+            Возвращает соответствующее булевое значение.  */
+        bool isEmpty() const {
+            return head == nullptr;
+        }
+
+        // Метод возвращает длину списка на текущий момент.
+        size_t size() const {
+            return sizeOfList;
+        }
+
+        // Метод возвращает значение первого элемента списка по ссылке.
+        T& front() const
+        {
+            if (head == nullptr) {
+                throw std::runtime_error("Error! The list is empty - you cannot refer to the first element.");
+            }
+
+            return head->values()[0];
+        }
+
+        // Метод возвращает значение последнего элемента списка по ссылке.
+        T& back() const
+        {
+            if (head == nullptr) {
+                throw std::runtime_error("Error! The list is empty - you cannot refer to the last element.");
+            }
+
+            return tail->values()[tail->count - 1];
+        }
+
+        // Метод выводит значения всех элементов в порядке их расположения в списке.
+        void print() const
+        {
+            for (const T& value : *this) {
+                std::cout << value << ' ';
+            }
+
+            std::cout << '\n';
+        }
+
+        /*  Метод ищет первый элемент со значением value и возвращает указатель
+            на него. Если элемент не найден - возвращает nullptr.  */
+        T* find(const T& value) const
+        {
+            size_t position = 0;
+            Chunk* chunk = locateValue(value, position);
+
+            return (chunk != nullptr) ? chunk->values() + position : nullptr;
+        }
+
+        /*  Метод проверяет, есть ли в списке элемент со значением value.
+            Возвращает соответствующее булевое значение.  */
+        bool contains(const T& value) const {
+            return find(value) != nullptr;
+        }
+
+        /*  Метод сортирует список по возрастанию (устойчиво).
+            Элементы переносятся во временный массив, сортируются и возвращаются обратно в те же фрагменты.  */
+        void sort() {
+            sort(std::less<>());
+        }
+
+        template <typename Compare>
+        void sort(Compare comparator)
+        {
+            if (sizeOfList < 2) {
+                return;
+            }
+
+            std::vector<T> elements;
+            elements.reserve(sizeOfList);
+
+            for (T& value : *this) {
+                elements.push_back(std::move(value));
+            }
+
+            std::stable_sort(elements.begin(), elements.end(), comparator);
+
+            size_t i = 0;
+            for (T& value : *this) {
+                value = std::move(elements[i++]);
+            }
+        }
+
+        // Метод полностью очищает список (память фрагментов возвращается в кучу целиком).
+        void clear()
+        {
+            if constexpr (!std::is_trivially_destructible<T>::value)
+            {
+                for (Chunk* chunk = head; chunk != nullptr; chunk = chunk->next)
+                {
+                    T* values = chunk->values();
+
+                    for (size_t i = 0; i < chunk->count; ++i) {
+                        values[i].~T();
+                    }
+                }
+            }
+
+            sizeOfList = 0;
+            head = nullptr;
+            tail = nullptr;
+            pool.releaseAll();
+        }
+
+        /*  Метод удаляет первый элемент со значением valueToRemove.
+            Возвращает true, если элемент был найден и удалён, иначе - false.  */
+        bool remove(const T& valueToRemove)
+        {
+            size_t position = 0;
+            Chunk* chunk = locateValue(valueToRemove, position);
+
+            if (chunk == nullptr) {
+                return false;
+            }
+
+            eraseFromChunk(chunk, position);
+
+            return true;
+        }
+
+        /*  Метод удаляет все элементы со значением valueToRemove.
+            Возвращает true, если хотя бы один элемент был удалён, иначе - false. */
+        bool removeAll(const T& valueToRemove)
+        {
+            // 1. Копирую значение: оно может ссылаться на элемент самого списка, который будет удалён или сдвинут.
+            const T value(valueToRemove);
+            const size_t oldSize = sizeOfList;
+
+            Chunk* chunk = head;
+
+            while (chunk != nullptr)
+            {
+                Chunk* next = chunk->next;
+
+                // 2. Уплотняю фрагмент за один проход: оставшиеся элементы сдвигаются к началу массива.
+                compactChunk(chunk, value);
+
+                // 3. Пустой фрагмент удаляю, а недозаполненный - сливаю с предыдущим, если их элементы умещаются в один.
+                Chunk* prev = chunk->prev;
+
+                if (chunk->count == 0) {
+                    destroyChunk(chunk);
+                }
+                else if (prev != nullptr && (prev->count < chunkCapacity / 2 || chunk->count < chunkCapacity / 2)
+                                         && prev->count + chunk->count <= chunkCapacity)
+                {
+                    relocate(chunk->values(), prev->values() + prev->count, chunk->count);
+                    prev->count += chunk->count;
+                    chunk->count = 0;
+
+                    destroyChunk(chunk);
+                }
+
+                chunk = next;
+            }
+
+            return sizeOfList != oldSize;
+        }
+
+        // Метод вставляет значение так, чтобы оно получило индекс index (index == size() - вставка в конец).
+        void insert(size_t index, const T& value)
+        {
+            if (index > sizeOfList) {
+                throw std::out_of_range("Error! The index is out of range.");
+            }
+
+            if (index == sizeOfList)
+            {
+                pushBack(value);
+                return;
+            }
+
+            // 1. Копирую значение: оно может ссылаться на элемент, который сдвинется при вставке.
+            T copy(value);
+
+            // 2. Нахожу фрагмент с элементом index; если он заполнен - делю его пополам.
+            size_t position = 0;
+            Chunk* chunk = locate(index, position);
+
+            if (chunk->count == chunkCapacity)
+            {
+                Chunk* second = splitChunk(chunk);
+
+                if (position > chunk->count)
+                {
+                    position -= chunk->count;
+                    chunk = second;
+                }
+            }
+
+            // 3. Вставляю значение в найденный фрагмент.
+            insertIntoChunk(chunk, position, std::move(copy));
+        }
+
+        // Метод удаляет элемент с индексом index и возвращает его значение.
+        T erase(size_t index)
+        {
+            if (index >= sizeOfList) {
+                throw std::out_of_range("Error! The index is out of range.");
+            }
+
+            size_t position = 0;
+            Chunk* chunk = locate(index, position);
+
+            T deleted = std::move(chunk->values()[position]);
+            eraseFromChunk(chunk, position);
+
+            return deleted;
+        }
+
+        // Метод добавляет новый элемент в начало списка.
+        void pushFront(const T& value)
+        {
+            T copy(value);
+
+            if (head == nullptr || head->count == chunkCapacity) {
+                createChunkAfter(nullptr);
+            }
+
+            insertIntoChunk(head, 0, std::move(copy));
+        }
+
+        // Метод добавляет новый элемент в конец списка.
+        void pushBack(const T& value)
+        {
+            if (tail == nullptr || tail->count == chunkCapacity)
+            {
+                // Новый фрагмент создаётся до копирования значения: value может ссылаться на элемент списка, но не перемещается.
+                Chunk* chunk = createChunkAfter(tail);
+
+                try {
+                    new (chunk->values()) T(value);
+                }
+                catch (...)
+                {
+                    destroyChunk(chunk);
+                    throw;
+                }
+
+                chunk->count = 1;
+                ++sizeOfList;
+                return;
+            }
+
+            new (tail->values() + tail->count) T(value);
+
+            ++tail->count;
+            ++sizeOfList;
+        }
+
+        /*  Метод удаляет первый элемент из списка.
+            Возвращает значение удаленного элемента.  */
+        T popFront()
+        {
+            if (head == nullptr) {
+                throw std::runtime_error("Error! It's not possible to delete item from empty list!");
+            }
+
+            T deleted = std::move(head->values()[0]);
+            eraseFromChunk(head, 0);
+
+            return deleted;
+        }
+
+        /*  Метод удаляет последний элемент из списка за O(1).
+            Возвращает значение удаленного элемента.  */
+        T popBack()
+        {
+            if (head == nullptr) {
+                throw std::runtime_error("Error! It's not possible to delete item from empty list!");
+            }
+
+            T deleted = std::move(tail->values()[tail->count - 1]);
+            eraseFromChunk(tail, tail->count - 1);
+
+            return deleted;
+        }
+    };
+}
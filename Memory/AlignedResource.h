@@ -0,0 +1,95 @@
+#pragma once
+#include <cstddef>
+#include <memory_resource>
+#include <stdexcept>
+
+// Пространство имен Containers предназначено для хранения различных контейнеров.
+namespace Containers
+{
+    /* AlignedResource - ресурс памяти, выравнивающий каждый выделенный блок по заданной границе.
+       Используется с контейнерами из Containers, которые принимают std::pmr::memory_resource:
+       например, Vector<float> values(&cacheLineResource) получает буфер, начало которого совпадает
+       с началом строки кэша, - векторизованные ядра читают его выровненными загрузками.
+       Сама память берётся у вышестоящего ресурса (по умолчанию - new/delete с выравниванием). */
+    class AlignedResource : public std::pmr::memory_resource
+    {
+    private:
+        /* === Данные ресурса: === */
+        std::pmr::memory_resource* upstream;    // Вышестоящий ресурс, у которого берутся блоки.
+        size_t blockAlignment;                  // Минимальное выравнивание каждого блока.
+
+
+        /* === Вспомогательный метод для выбора выравнивания запроса: === */
+        size_t alignmentFor(size_t requested) const;
+
+
+    protected:
+        /* === Реализация интерфейса std::pmr::memory_resource: === */
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void  do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+        bool  do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+
+    public:
+        /* === Распространённые значения выравнивания: === */
+        static constexpr size_t cacheLine = 64;         // Строка кэша.
+        static constexpr size_t page      = 4096;       // Страница памяти.
+
+
+        /* === Конструктор: === */
+        explicit AlignedResource(size_t alignment = cacheLine,
+                                 std::pmr::memory_resource* upstreamResource = std::pmr::new_delete_resource());
+
+
+        /* === Методы для получения информации о ресурсе: === */
+        size_t alignment() const;                       // Минимальное выравнивание блоков.
+    };
+
+} // namespace Containers.
+
+
+
+/* ... ОПРЕДЕЛЕНИЕ ФУНКЦИОНАЛЬНОСТИ КЛАССА ... */
+namespace Containers
+{
+
+    /* === Вспомогательный защищенный метод для выбора выравнивания запроса: === */
+    inline size_t AlignedResource::alignmentFor(size_t requested) const {
+        return (requested > blockAlignment) ? requested : blockAlignment;
+    }
+
+
+    /* === Реализация интерфейса std::pmr::memory_resource: === */
+    inline void* AlignedResource::do_allocate(size_t bytes, size_t alignment) {
+        return upstream->allocate(bytes, alignmentFor(alignment));
+    }
+
+    inline void AlignedResource::do_deallocate(void* pointer, size_t bytes, size_t alignment) {
+        upstream->deallocate(pointer, bytes, alignmentFor(alignment));
+    }
+
+    inline bool AlignedResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+    {
+        // Память одного ресурса может освободить другой, если у них одинаковое выравнивание и общий вышестоящий ресурс.
+        const AlignedResource* otherAligned = dynamic_cast<const AlignedResource*>(&other);
+
+        return this == &other
+            || (otherAligned != nullptr && otherAligned->blockAlignment == blockAlignment
+                && upstream->is_equal(*otherAligned->upstream));
+    }
+
+
+    /* === Конструктор: === */
+    inline AlignedResource::AlignedResource(size_t alignment, std::pmr::memory_resource* upstreamResource)
+        : upstream(upstreamResource), blockAlignment(alignment)
+    {
+        if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+            throw std::runtime_error("Error! Alignment must be a power of two.");
+        }
+    }
+
+
+    /* === Публичные методы для получения информации о ресурсе: === */
+    inline size_t AlignedResource::alignment() const { return blockAlignment; }
+
+} // namespace Containers.
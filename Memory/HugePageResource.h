@@ -0,0 +1,157 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+#include <sys/mman.h>
+
+// Пространство имен Containers предназначено для хранения различных контейнеров.
+namespace Containers
+{
+    /* HugePageResource - ресурс памяти, размещающий крупные блоки на больших страницах (2 МиБ).
+       Блок от threshold байт и больше отображается через mmap: сначала с MAP_HUGETLB (заранее выделенные
+       большие страницы), а если их нет - обычным отображением, выровненным по 2 МиБ, с подсказкой
+       madvise(MADV_HUGEPAGE) для прозрачных больших страниц. Меньшие блоки уходят вышестоящему ресурсу.
+       Большие страницы уменьшают число промахов TLB при проходах по многогигабайтным векторам. */
+    class HugePageResource : public std::pmr::memory_resource
+    {
+    private:
+        /* === Данные ресурса: === */
+        std::pmr::memory_resource* upstream;    // Ресурс для блоков меньше порога.
+        size_t threshold;                       // Минимальный размер блока для больших страниц.
+        bool   explicitPages;                   // Пробовать ли MAP_HUGETLB перед прозрачными страницами.
+
+        std::atomic<size_t> explicitCount{ 0 };    // Сколько блоков получено на MAP_HUGETLB.
+        std::atomic<size_t> transparentCount{ 0 }; // Сколько блоков получено с MADV_HUGEPAGE.
+
+
+        /* === Вспомогательные методы: === */
+        bool   isHuge(size_t bytes, size_t alignment) const; // Обслуживается ли запрос большими страницами.
+        static size_t roundUp(size_t bytes);                 // Округление вверх до размера большой страницы.
+        static void*  mapTransparent(size_t length);         // Отображение, выровненное по большой странице.
+
+
+    protected:
+        /* === Реализация интерфейса std::pmr::memory_resource: === */
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void  do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+        bool  do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+
+    public:
+        /* === Размер большой страницы: === */
+        static constexpr size_t hugePageSize = size_t(2) << 20;
+
+
+        /* === Конструктор: === */
+        explicit HugePageResource(size_t minimalBytes = hugePageSize, bool useExplicitPages = true,
+                                  std::pmr::memory_resource* upstreamResource = std::pmr::new_delete_resource());
+
+
+        /* === Методы для получения информации о ресурсе: === */
+        size_t explicitAllocations()    const;      // Количество блоков на заранее выделенных больших страницах.
+        size_t transparentAllocations() const;      // Количество блоков на прозрачных больших страницах.
+    };
+
+} // namespace Containers.
+
+
+
+/* ... ОПРЕДЕЛЕНИЕ ФУНКЦИОНАЛЬНОСТИ КЛАССА ... */
+namespace Containers
+{
+
+    /* === Вспомогательные защищенные методы: === */
+    inline bool HugePageResource::isHuge(size_t bytes, size_t alignment) const {
+        return bytes >= threshold && alignment <= hugePageSize;
+    }
+
+    inline size_t HugePageResource::roundUp(size_t bytes) {
+        return (bytes + hugePageSize - 1) & ~(hugePageSize - 1);
+    }
+
+    inline void* HugePageResource::mapTransparent(size_t length)
+    {
+        // Отображаю с запасом в одну большую страницу и обрезаю края, чтобы начало было выровнено по 2 МиБ.
+        const size_t padded = length + hugePageSize;
+        void* raw = ::mmap(nullptr, padded, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (raw == MAP_FAILED) { return nullptr; }
+
+        const uintptr_t start   = reinterpret_cast<uintptr_t>(raw);
+        const uintptr_t aligned = (start + hugePageSize - 1) & ~static_cast<uintptr_t>(hugePageSize - 1);
+
+        if (aligned != start) { ::munmap(raw, aligned - start); }
+        if (aligned + length != start + padded) {
+            ::munmap(reinterpret_cast<void*>(aligned + length), start + padded - aligned - length);
+        }
+
+#ifdef MADV_HUGEPAGE
+        // Подсказка ядру; если прозрачные большие страницы отключены, память просто остаётся обычной.
+        ::madvise(reinterpret_cast<void*>(aligned), length, MADV_HUGEPAGE);
+#endif
+
+        return reinterpret_cast<void*>(aligned);
+    }
+
+
+    /* === Реализация интерфейса std::pmr::memory_resource: === */
+    inline void* HugePageResource::do_allocate(size_t bytes, size_t alignment)
+    {
+        if (!isHuge(bytes, alignment)) {
+            return upstream->allocate(bytes, alignment);
+        }
+
+        const size_t length = roundUp(bytes);
+
+#ifdef MAP_HUGETLB
+        // 1. Заранее выделенные большие страницы (vm.nr_hugepages) - могут быть недоступны.
+        if (explicitPages)
+        {
+            void* pointer = ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            if (pointer != MAP_FAILED)
+            {
+                explicitCount.fetch_add(1, std::memory_order_relaxed);
+                return pointer;
+            }
+        }
+#endif
+
+        // 2. Запасной путь - обычное отображение с подсказкой для прозрачных больших страниц.
+        void* pointer = mapTransparent(length);
+        if (pointer == nullptr) { throw std::bad_alloc(); }
+
+        transparentCount.fetch_add(1, std::memory_order_relaxed);
+        return pointer;
+    }
+
+    inline void HugePageResource::do_deallocate(void* pointer, size_t bytes, size_t alignment)
+    {
+        if (!isHuge(bytes, alignment)) {
+            upstream->deallocate(pointer, bytes, alignment);
+            return;
+        }
+
+        ::munmap(pointer, roundUp(bytes));
+    }
+
+    inline bool HugePageResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+    {
+        // Крупные блоки освобождаются через munmap, поэтому важны лишь порог и вышестоящий ресурс.
+        const HugePageResource* otherHuge = dynamic_cast<const HugePageResource*>(&other);
+
+        return this == &other
+            || (otherHuge != nullptr && otherHuge->threshold == threshold && upstream->is_equal(*otherHuge->upstream));
+    }
+
+
+    /* === Конструктор: === */
+    inline HugePageResource::HugePageResource(size_t minimalBytes, bool useExplicitPages, std::pmr::memory_resource* upstreamResource)
+        : upstream(upstreamResource), threshold(minimalBytes == 0 ? 1 : minimalBytes), explicitPages(useExplicitPages) {}
+
+
+    /* === Публичные методы для получения информации о ресурсе: === */
+    inline size_t HugePageResource::explicitAllocations()    const { return explicitCount.load(std::memory_order_relaxed); }
+    inline size_t HugePageResource::transparentAllocations() const { return transparentCount.load(std::memory_order_relaxed); }
+
+} // namespace Containers.
\ No newline at end of file
@@ -0,0 +1,165 @@
+#pragma once
+#include <cstddef>
+#include <memory_resource>
+
+// Пространство имен Containers предназначено для хранения различных контейнеров.
+namespace Containers
+{
+    /* MonotonicArena - монотонный ресурс памяти (арена) для контейнеров из Containers.
+       Память выдаётся сдвигом указателя внутри крупных блоков, запрошенных у вышестоящего ресурса,
+       а освобождение отдельных объектов ничего не делает. Вся память арены возвращается разом:
+       методом reset() (самый большой блок сохраняется для повторного использования) или release().
+       Класс не потокобезопасен: арена рассчитана на использование в рамках одного запроса/потока. */
+    class MonotonicArena : public std::pmr::memory_resource
+    {
+    private:
+        /* === Заголовок блока памяти (хранится в начале каждого блока): === */
+        struct Block
+        {
+            Block* next;                    // Указатель на предыдущий выделенный блок.
+            size_t size;                    // Полный размер блока (вместе с заголовком).
+        };
+
+
+        /* === Данные арены: === */
+        std::pmr::memory_resource* upstream;    // Вышестоящий ресурс, у которого арена берёт блоки.
+        Block*  blocks        = nullptr;        // Список выделенных блоков (последний - в начале).
+        char*   currPointer   = nullptr;        // Начало свободной части текущего блока.
+        char*   endPointer    = nullptr;        // Конец текущего блока.
+        size_t  nextBlockSize;                  // Размер следующего запрашиваемого блока.
+        size_t  usedBytes     = 0;              // Количество байт, выданных с момента последнего сброса.
+
+
+        /* === Вспомогательный метод для получения нового блока: === */
+        void addBlock(size_t minimalSize, size_t alignment);
+
+
+    protected:
+        /* === Реализация интерфейса std::pmr::memory_resource: === */
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void  do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+        bool  do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+
+    public:
+        /* === Конструкторы и деструктор: === */
+        explicit MonotonicArena(size_t initialBlockSize = 64 * 1024,
+                                std::pmr::memory_resource* upstreamResource = std::pmr::new_delete_resource());
+
+        MonotonicArena(const MonotonicArena&) = delete;             // Копирование арены запрещено.
+        MonotonicArena& operator=(const MonotonicArena&) = delete;  // Присваивание арены запрещено.
+
+        ~MonotonicArena() override;                                 // Деструктор (возвращает все блоки).
+
+
+        /* === Методы для освобождения памяти арены: === */
+        void reset();                   // Сброс арены: вся память считается свободной, самый большой блок сохраняется.
+        void release();                 // Возврат всех блоков вышестоящему ресурсу.
+
+
+        /* === Методы для получения информации об арене: === */
+        size_t bytesUsed() const;       // Количество байт, выданных с момента последнего сброса.
+    };
+
+} // namespace Containers.
+
+
+
+/* ... ОПРЕДЕЛЕНИЕ ФУНКЦИОНАЛЬНОСТИ КЛАССА ... */
+namespace Containers
+{
+
+    /* === Вспомогательный защищенный метод для получения нового блока: === */
+    inline void MonotonicArena::addBlock(size_t minimalSize, size_t alignment)
+    {
+        // Размер блока растёт геометрически, но всегда вмещает запрошенный объект с учётом выравнивания.
+        size_t blockSize = sizeof(Block) + minimalSize + alignment;
+        if (blockSize < nextBlockSize) { blockSize = nextBlockSize; }
+
+        Block* newBlock = static_cast<Block*>(upstream->allocate(blockSize, alignof(std::max_align_t)));
+        newBlock->next = blocks;
+        newBlock->size = blockSize;
+
+        blocks = newBlock;
+        currPointer = reinterpret_cast<char*>(newBlock + 1);
+        endPointer = reinterpret_cast<char*>(newBlock) + blockSize;
+
+        nextBlockSize = blockSize * 2;
+    }
+
+
+    /* === Реализация интерфейса std::pmr::memory_resource: === */
+    inline void* MonotonicArena::do_allocate(size_t bytes, size_t alignment)
+    {
+        // Выравниваю текущую позицию; если места в блоке не хватает - беру новый блок.
+        size_t padding = (alignment - reinterpret_cast<size_t>(currPointer) % alignment) % alignment;
+
+        if (currPointer == nullptr || static_cast<size_t>(endPointer - currPointer) < padding + bytes)
+        {
+            addBlock(bytes, alignment);
+            padding = (alignment - reinterpret_cast<size_t>(currPointer) % alignment) % alignment;
+        }
+
+        char* result = currPointer + padding;
+        currPointer = result + bytes;
+        usedBytes += bytes;
+
+        return result;
+    }
+
+    inline void MonotonicArena::do_deallocate(void*, size_t, size_t) {
+        // Отдельные объекты не освобождаются - память возвращается целиком через reset() / release().
+    }
+
+    inline bool MonotonicArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+        return this == &other;
+    }
+
+
+    /* === Конструкторы и деструктор: === */
+    inline MonotonicArena::MonotonicArena(size_t initialBlockSize, std::pmr::memory_resource* upstreamResource)
+        : upstream(upstreamResource), nextBlockSize(initialBlockSize) {}
+
+    inline MonotonicArena::~MonotonicArena() { release(); }
+
+
+    /* === Публичные методы для освобождения памяти арены: === */
+    inline void MonotonicArena::reset()
+    {
+        if (blocks == nullptr) { return; }
+
+        // Последний блок всегда самый большой - оставляю его, остальные возвращаю вышестоящему ресурсу.
+        Block* keptBlock = blocks;
+        Block* currBlock = blocks->next;
+
+        while (currBlock != nullptr)
+        {
+            Block* nextBlock = currBlock->next;
+            upstream->deallocate(currBlock, currBlock->size, alignof(std::max_align_t));
+            currBlock = nextBlock;
+        }
+
+        keptBlock->next = nullptr;
+        currPointer = reinterpret_cast<char*>(keptBlock + 1);
+        usedBytes = 0;
+    }
+
+    inline void MonotonicArena::release()
+    {
+        while (blocks != nullptr)
+        {
+            Block* nextBlock = blocks->next;
+            upstream->deallocate(blocks, blocks->size, alignof(std::max_align_t));
+            blocks = nextBlock;
+        }
+
+        currPointer = nullptr;
+        endPointer = nullptr;
+        usedBytes = 0;
+    }
+
+
+    /* === Публичные методы для получения информации об арене: === */
+    inline size_t MonotonicArena::bytesUsed() const { return usedBytes; }
+
+} // namespace Containers.
\ No newline at end of file
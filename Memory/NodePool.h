@@ -0,0 +1,212 @@
+#pragma once
+#include <cstddef>
+#include <new>
+
+// Пространство имен Containers предназначено для хранения различных контейнеров.
+namespace Containers
+{
+    /* NodePool - пул узлов одного типа для узловых контейнеров (списков).
+       Узлы нарезаются из крупных блоков (slab), размер которых растёт вдвое до maxSlabNodes узлов.
+       Освобождённый узел попадает в список свободных и переиспользуется следующим выделением,
+       поэтому при работе контейнера как очереди обращений к куче почти нет. Блоки возвращаются
+       в кучу только целиком (releaseAll() и деструктор) - к этому моменту узлы должны быть уничтожены.
+       Пул выдаёт только память: узлы создаются и уничтожаются самим контейнером. */
+    template<typename Node>
+    class NodePool
+    {
+    private:
+        /* === Заголовок блока (хранится в начале блока, узлы - после него): === */
+        struct Slab
+        {
+            Slab*  next;                                // Предыдущий выделенный блок.
+            size_t bytes;                               // Полный размер блока.
+        };
+
+        /* === Освобождённый узел (память узла хранит ссылку на следующий свободный): === */
+        struct FreeNode
+        {
+            FreeNode* next;
+        };
+
+        static_assert(sizeof(Node) >= sizeof(FreeNode), "Error! Node is too small for the node pool.");
+
+
+        /* === Размеры и выравнивание: === */
+        static constexpr size_t nodeAlignment = alignof(Node) > alignof(Slab) ? alignof(Node) : alignof(Slab);
+        static constexpr size_t headerSize    = (sizeof(Slab) + nodeAlignment - 1) / nodeAlignment * nodeAlignment;
+        static constexpr size_t minSlabNodes  = 32;
+        static constexpr size_t maxSlabNodes  = 4096;
+
+
+        /* === Данные пула: === */
+        Slab*     slabs         = nullptr;              // Все блоки пула (последний выделенный - в начале).
+        FreeNode* freeNodes     = nullptr;              // Список свободных узлов.
+        char*     cursor        = nullptr;              // Начало ещё не нарезанной части текущего блока.
+        size_t    remaining     = 0;                    // Сколько узлов ещё можно нарезать из текущего блока.
+        size_t    nextSlabNodes = minSlabNodes;         // Размер следующего блока (в узлах).
+
+
+    public:
+        /* === Конструкторы и деструктор: === */
+        NodePool() = default;                           // Конструктор по умолчанию (без выделения памяти).
+        NodePool(NodePool&& other) noexcept;            // Конструктор перемещения (блоки переходят к новому пулу).
+        NodePool(const NodePool&) = delete;             // Копирование пула запрещено.
+        ~NodePool();                                    // Деструктор (возвращает все блоки).
+
+
+        /* === Перегруженные операторы: === */
+        NodePool& operator=(NodePool&& other) noexcept; // Оператор присваивания перемещением.
+        NodePool& operator=(const NodePool&) = delete;  // Присваивание копированием запрещено.
+
+
+        /* === Методы для работы с памятью узлов: === */
+        void* allocate();                               // Память под один узел.
+        void  deallocate(void* memory);                 // Возврат памяти узла в список свободных.
+        void  absorb(NodePool& other);                  // Присоединение блоков другого пула (после переноса его узлов).
+        void  releaseAll();                             // Возврат всех блоков в кучу.
+    };
+
+} // namespace Containers.
+
+
+
+/* ... ОПРЕДЕЛЕНИЕ ФУНКЦИОНАЛЬНОСТИ КЛАССА ... */
+namespace Containers
+{
+
+    /* === Конструкторы и деструктор: === */
+    template<typename Node>
+    NodePool<Node>::NodePool(NodePool&& other) noexcept(true)
+        : slabs(other.slabs), freeNodes(other.freeNodes), cursor(other.cursor), remaining(other.remaining), nextSlabNodes(other.nextSlabNodes)
+    {
+        other.slabs = nullptr;
+        other.freeNodes = nullptr;
+        other.cursor = nullptr;
+        other.remaining = 0;
+        other.nextSlabNodes = minSlabNodes;
+    }
+
+    template<typename Node>
+    NodePool<Node>::~NodePool() { releaseAll(); }
+
+
+    /* === Перегруженные операторы: === */
+    template<typename Node>
+    NodePool<Node>& NodePool<Node>::operator=(NodePool&& other) noexcept(true)
+    {
+        if (this != &other)
+        {
+            releaseAll();
+
+            slabs = other.slabs;
+            freeNodes = other.freeNodes;
+            cursor = other.cursor;
+            remaining = other.remaining;
+            nextSlabNodes = other.nextSlabNodes;
+
+            other.slabs = nullptr;
+            other.freeNodes = nullptr;
+            other.cursor = nullptr;
+            other.remaining = 0;
+            other.nextSlabNodes = minSlabNodes;
+        }
+
+        return *this;
+    }
+
+
+    /* === Публичные методы для работы с памятью узлов: === */
+    template<typename Node>
+    void* NodePool<Node>::allocate()
+    {
+        // 1. В первую очередь переиспользую освобождённый узел.
+        if (freeNodes != nullptr)
+        {
+            FreeNode* node = freeNodes;
+            freeNodes = node->next;
+            return node;
+        }
+
+        // 2. Если текущий блок исчерпан - выделяю новый (вдвое больше предыдущего).
+        if (remaining == 0)
+        {
+            const size_t bytes = headerSize + nextSlabNodes * sizeof(Node);
+            Slab* slab = static_cast<Slab*>(::operator new(bytes, std::align_val_t(nodeAlignment)));
+
+            slab->next = slabs;
+            slab->bytes = bytes;
+            slabs = slab;
+
+            cursor = reinterpret_cast<char*>(slab) + headerSize;
+            remaining = nextSlabNodes;
+
+            if (nextSlabNodes < maxSlabNodes) {
+                nextSlabNodes *= 2;
+            }
+        }
+
+        // 3. Отрезаю очередной узел от текущего блока.
+        void* node = cursor;
+        cursor += sizeof(Node);
+        --remaining;
+
+        return node;
+    }
+
+    template<typename Node>
+    void NodePool<Node>::deallocate(void* memory)
+    {
+        FreeNode* node = static_cast<FreeNode*>(memory);
+        node->next = freeNodes;
+        freeNodes = node;
+    }
+
+    template<typename Node>
+    void NodePool<Node>::absorb(NodePool& other)
+    {
+        if (this == &other) { return; }
+
+        // Блоки другого пула дописываю в свой список блоков.
+        if (other.slabs != nullptr)
+        {
+            Slab* lastSlab = other.slabs;
+            while (lastSlab->next != nullptr) {
+                lastSlab = lastSlab->next;
+            }
+
+            lastSlab->next = slabs;
+            slabs = other.slabs;
+        }
+
+        // Свободные узлы другого пула тоже можно переиспользовать.
+        while (other.freeNodes != nullptr)
+        {
+            FreeNode* node = other.freeNodes;
+            other.freeNodes = node->next;
+            deallocate(node);
+        }
+
+        // Не нарезанный остаток блока другого пула остаётся неиспользованным до освобождения блоков.
+        other.slabs = nullptr;
+        other.cursor = nullptr;
+        other.remaining = 0;
+        other.nextSlabNodes = minSlabNodes;
+    }
+
+    template<typename Node>
+    void NodePool<Node>::releaseAll()
+    {
+        while (slabs != nullptr)
+        {
+            Slab* next = slabs->next;
+            ::operator delete(slabs, slabs->bytes, std::align_val_t(nodeAlignment));
+            slabs = next;
+        }
+
+        freeNodes = nullptr;
+        cursor = nullptr;
+        remaining = 0;
+        nextSlabNodes = minSlabNodes;
+    }
+
+} // namespace Containers.
@@ -0,0 +1,275 @@
+#pragma once
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <vector>
+#include "ThreadPool.h"
+#include "../Vector/Vector.h"
+
+// Пространство имен Containers предназначено для хранения различных контейнеров.
+namespace Containers
+{
+    /* ParallelOptions - параметры параллельных алгоритмов над Vector.
+       Число потоков задаётся пулом (ThreadPool(threadCount)), размер порции работы - grainSize:
+       диапазон делится пополам, пока в нём больше grainSize элементов, и каждая половина становится задачей. */
+    struct ParallelOptions
+    {
+        ThreadPool* pool      = nullptr;    // Пул потоков (nullptr - общий пул ThreadPool::global()).
+        size_t      grainSize = 0;          // Минимальный размер порции в элементах (0 - подбирается по размеру вектора и числу потоков).
+    };
+
+
+    /* === Параллельные алгоритмы: === */
+    template<typename T, typename F>
+    void parallelForEach(Vector<T>& vector, F function, const ParallelOptions& options = {});       // Вызов function(element) для каждого элемента.
+
+    template<typename T, typename U, typename F>
+    void parallelTransform(const Vector<T>& source, Vector<U>& destination, F function,
+                           const ParallelOptions& options = {});                                  // destination[i] = function(source[i]).
+
+    template<typename T, typename R, typename BinaryOp = std::plus<>>
+    R parallelReduce(const Vector<T>& vector, R identity, BinaryOp operation = {},
+                     const ParallelOptions& options = {});                                        // Свёртка ассоциативной операцией (результат типа R).
+
+    template<typename T, typename R, typename FoldOp, typename CombineOp>
+    R parallelReduce(const Vector<T>& vector, R identity, FoldOp fold, CombineOp combine,
+                     const ParallelOptions& options = {});                                        // Свёртка fold(R, T) с объединением порций combine(R, R).
+
+    template<typename T, typename Compare = std::less<>>
+    void parallelSort(Vector<T>& vector, Compare comparator = {}, const ParallelOptions& options = {}); // Сортировка (неустойчивая).
+
+} // namespace Containers.
+
+
+
+/* ... ОПРЕДЕЛЕНИЕ ФУНКЦИОНАЛЬНОСТИ ... */
+namespace Containers
+{
+    // Пространство имен Parallel содержит вспомогательные функции параллельных алгоритмов.
+    namespace Parallel
+    {
+        /* === Выбор пула и размера порции: === */
+        inline ThreadPool& poolFor(const ParallelOptions& options) {
+            return (options.pool != nullptr) ? *options.pool : ThreadPool::global();
+        }
+
+        inline size_t grainFor(size_t count, const ThreadPool& pool, const ParallelOptions& options, size_t minimalGrain)
+        {
+            if (options.grainSize != 0) { return options.grainSize; }
+
+            // По умолчанию - около 8 порций на поток (чтобы было что перехватывать), но не мельче minimalGrain.
+            const size_t portions = pool.threadCount() * 8;
+            return std::max(minimalGrain, (count + portions - 1) / portions);
+        }
+
+
+        /* === Рекурсивное деление диапазона [begin, end) на задачи: === */
+        template<typename F>
+        void splitRange(ThreadPool::TaskGroup& group, size_t begin, size_t end, size_t grain, const F& body)
+        {
+            // Правые половины отдаю в пул (их перехватят свободные потоки), левую часть обрабатываю сам.
+            while (end - begin > grain)
+            {
+                const size_t middle = begin + (end - begin) / 2;
+                group.run([&group, &body, middle, end, grain] { splitRange(group, middle, end, grain, body); });
+                end = middle;
+            }
+
+            body(begin, end);
+        }
+
+        template<typename F>
+        void forRange(ThreadPool& pool, size_t begin, size_t end, size_t grain, const F& body)
+        {
+            if (end - begin <= grain || pool.threadCount() == 1)
+            {
+                body(begin, end);
+                return;
+            }
+
+            ThreadPool::TaskGroup group(pool);
+            splitRange(group, begin, end, grain, body);
+            group.wait();
+        }
+
+
+        /* === Параллельный запуск двух функций (fork-join): === */
+        template<typename F1, typename F2>
+        void invoke(ThreadPool& pool, const F1& first, const F2& second)
+        {
+            ThreadPool::TaskGroup group(pool);
+            group.run([&first] { first(); });
+            second();
+            group.wait();
+        }
+
+
+        /* === Параллельное слияние двух отсортированных диапазонов в out (элементы перемещаются): === */
+        template<typename T, typename Compare>
+        void merge(ThreadPool& pool, T* first1, T* last1, T* first2, T* last2, T* out, size_t grain, const Compare& comparator)
+        {
+            const size_t count1 = static_cast<size_t>(last1 - first1);
+            const size_t count2 = static_cast<size_t>(last2 - first2);
+
+            if (count1 + count2 <= grain)
+            {
+                std::merge(std::make_move_iterator(first1), std::make_move_iterator(last1),
+                           std::make_move_iterator(first2), std::make_move_iterator(last2), out, comparator);
+                return;
+            }
+
+            /* Делю больший диапазон пополам, а в меньшем бинарным поиском нахожу соответствующую точку.
+               lower_bound / upper_bound выбраны так, чтобы равные элементы первого диапазона шли раньше. */
+            T* split1;
+            T* split2;
+
+            if (count1 >= count2)
+            {
+                split1 = first1 + count1 / 2;
+                split2 = std::lower_bound(first2, last2, *split1, comparator);
+            }
+            else
+            {
+                split2 = first2 + count2 / 2;
+                split1 = std::upper_bound(first1, last1, *split2, comparator);
+            }
+
+            T* outSplit = out + (split1 - first1) + (split2 - first2);
+
+            invoke(pool,
+                [&] { merge(pool, first1, split1, first2, split2, out, grain, comparator); },
+                [&] { merge(pool, split1, last1, split2, last2, outSplit, grain, comparator); });
+        }
+
+
+        /* === Параллельная сортировка слиянием: результат оказывается в buffer, если intoBuffer, иначе в data: === */
+        template<typename T, typename Compare>
+        void mergeSort(ThreadPool& pool, T* data, T* buffer, size_t count, size_t grain, bool intoBuffer, const Compare& comparator)
+        {
+            if (count <= grain)
+            {
+                std::sort(data, data + count, comparator);
+                if (intoBuffer) { std::move(data, data + count, buffer); }
+                return;
+            }
+
+            // Половины сортируются в "противоположный" массив, а затем сливаются в нужный.
+            const size_t half = count / 2;
+
+            invoke(pool,
+                [&] { mergeSort(pool, data, buffer, half, grain, !intoBuffer, comparator); },
+                [&] { mergeSort(pool, data + half, buffer + half, count - half, grain, !intoBuffer, comparator); });
+
+            T* from = intoBuffer ? data : buffer;
+            T* to   = intoBuffer ? buffer : data;
+
+            merge(pool, from, from + half, from + half, from + count, to, grain, comparator);
+        }
+
+    } // namespace Parallel.
+
+
+    /* === Параллельные алгоритмы: === */
+    template<typename T, typename F>
+    void parallelForEach(Vector<T>& vector, F function, const ParallelOptions& options)
+    {
+        if (vector.isEmpty()) { return; }
+
+        ThreadPool& pool = Parallel::poolFor(options);
+        T* data = &*vector.begin();
+
+        Parallel::forRange(pool, 0, vector.size(), Parallel::grainFor(vector.size(), pool, options, 2048),
+            [data, &function](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) { function(data[i]); }
+            });
+    }
+
+    template<typename T, typename U, typename F>
+    void parallelTransform(const Vector<T>& source, Vector<U>& destination, F function, const ParallelOptions& options)
+    {
+        /* Приёмник заранее получает нужный размер (U должен создаваться по умолчанию), после чего
+           потоки пишут каждый в свою часть. source и destination могут быть одним и тем же вектором. */
+        destination.resize(source.size());
+        if (source.isEmpty()) { return; }
+
+        ThreadPool& pool = Parallel::poolFor(options);
+        const T* input = &*source.begin();
+        U* output = &*destination.begin();
+
+        Parallel::forRange(pool, 0, source.size(), Parallel::grainFor(source.size(), pool, options, 2048),
+            [input, output, &function](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) { output[i] = function(input[i]); }
+            });
+    }
+
+    /* identity должен быть нейтральным элементом операции (0 для сложения, 1 для умножения, пустая строка для
+       конкатенации), а сама операция - ассоциативной (не обязательно коммутативной): каждая порция сворачивается
+       от своей копии identity, и только тогда результат совпадает с последовательной свёрткой. */
+    template<typename T, typename R, typename BinaryOp>
+    R parallelReduce(const Vector<T>& vector, R identity, BinaryOp operation, const ParallelOptions& options)
+    {
+        return parallelReduce(vector, std::move(identity), operation, operation, options);
+    }
+
+    /* Вариант для свёрток "в стиле accumulate", где элемент и результат разных типов (например, суммарная длина строк):
+       fold(R, const T&) добавляет элемент к результату порции, combine(R, R) объединяет результаты соседних порций. */
+    template<typename T, typename R, typename FoldOp, typename CombineOp>
+    R parallelReduce(const Vector<T>& vector, R identity, FoldOp fold, CombineOp combine, const ParallelOptions& options)
+    {
+        if (vector.isEmpty()) { return identity; }
+
+        ThreadPool& pool = Parallel::poolFor(options);
+        const T* data = &*vector.begin();
+        const size_t count = vector.size();
+        const size_t grain = Parallel::grainFor(count, pool, options, 4096);
+
+        // Каждая порция сворачивается независимо, а частичные результаты объединяются по порядку.
+        const size_t portionCount = (count + grain - 1) / grain;
+        std::vector<std::optional<R>> partial(portionCount);
+
+        Parallel::forRange(pool, 0, portionCount, 1,
+            [data, count, grain, &identity, &partial, &fold](size_t begin, size_t end) {
+                for (size_t portion = begin; portion < end; ++portion)
+                {
+                    const size_t first = portion * grain;
+                    const size_t last  = std::min(count, first + grain);
+
+                    R accumulator = identity;
+                    for (size_t i = first; i < last; ++i) { accumulator = fold(std::move(accumulator), data[i]); }
+
+                    partial[portion].emplace(std::move(accumulator));
+                }
+            });
+
+        R result = std::move(*partial[0]);
+        for (size_t portion = 1; portion < portionCount; ++portion) { result = combine(std::move(result), std::move(*partial[portion])); }
+        return result;
+    }
+
+    template<typename T, typename Compare>
+    void parallelSort(Vector<T>& vector, Compare comparator, const ParallelOptions& options)
+    {
+        ThreadPool& pool = Parallel::poolFor(options);
+        const size_t count = vector.size();
+
+        // Порция должна быть не меньше 2, иначе слияние двух одноэлементных диапазонов не делится.
+        const size_t grain = std::max<size_t>(2, Parallel::grainFor(count, pool, options, 8192));
+
+        if (count <= grain || pool.threadCount() == 1)
+        {
+            if (count > 1) { std::sort(vector.begin(), vector.end(), comparator); }
+            return;
+        }
+
+        /* Сортировка слиянием с параллельным слиянием: в отличие от быстрой сортировки здесь нет
+           последовательного разбиения всего массива на верхнем уровне, поэтому она лучше масштабируется.
+           Элементы переезжают во временный вектор, а отсортированный результат сливается обратно. */
+        Vector<T> buffer;
+        buffer.reserve(count);
+        buffer.append(std::make_move_iterator(vector.begin()), std::make_move_iterator(vector.end()));
+
+        Parallel::mergeSort(pool, &*buffer.begin(), &*vector.begin(), count, grain, true, comparator);
+    }
+
+} // namespace Containers.
\ No newline at end of file
@@ -0,0 +1,309 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Пространство имен Containers предназначено для хранения различных контейнеров.
+namespace Containers
+{
+    /* ThreadPool - пул потоков с перехватом работы (work stealing).
+       У каждого рабочего потока своя очередь задач: новые задачи поток кладёт в конец своей очереди и
+       берёт оттуда же (так выше локальность данных), а простаивающие потоки "воруют" задачи из начала
+       чужих очередей. Задачи из внешних потоков попадают в общую очередь, доступную всем рабочим.
+       Поток, ожидающий завершения группы задач (TaskGroup::wait), не спит, а выполняет задачи сам -
+       поэтому вложенный параллелизм (например, рекурсивная сортировка) не приводит к взаимной блокировке. */
+    class ThreadPool
+    {
+    private:
+        /* === Очередь задач одного потока: === */
+        struct TaskQueue
+        {
+            std::mutex mutex;                           // Защита очереди.
+            std::deque<std::function<void()>> tasks;    // Задачи, ожидающие выполнения.
+        };
+
+        /* === Контекст текущего потока (к какому пулу и какой очереди он относится): === */
+        struct ThreadContext
+        {
+            ThreadPool* pool  = nullptr;
+            size_t      index = 0;
+        };
+
+
+        /* === Данные пула: === */
+        std::vector<std::unique_ptr<TaskQueue>> queues; // Очереди рабочих потоков + последняя общая (для внешних потоков).
+        std::vector<std::thread> workers;               // Рабочие потоки.
+
+        std::atomic<size_t> pendingTasks{ 0 };          // Количество задач в очередях.
+        std::atomic<bool>   stopping{ false };          // Признак завершения работы пула.
+
+        std::mutex              sleepMutex;             // Мьютекс для засыпания простаивающих потоков.
+        std::condition_variable wakeUp;                 // Сигнал о появлении новых задач.
+
+
+        /* === Вспомогательные методы: === */
+        static ThreadContext& context();                // Контекст текущего потока.
+        void workerLoop(size_t index);                  // Главный цикл рабочего потока.
+        bool tryPop(size_t index, std::function<void()>& task);   // Взятие задачи из конца своей очереди.
+        bool trySteal(size_t index, std::function<void()>& task); // Перехват задачи из начала чужой очереди.
+
+
+    public:
+        /* TaskGroup - группа задач, завершения которых можно дождаться.
+           Исключение, выброшенное любой задачей группы, повторно выбрасывается из wait(). */
+        class TaskGroup;
+
+
+        /* === Конструкторы и деструктор: === */
+        explicit ThreadPool(size_t threadCount = std::thread::hardware_concurrency()); // Пул на threadCount потоков (включая ожидающий).
+
+        ThreadPool(const ThreadPool&) = delete;             // Копирование пула запрещено.
+        ThreadPool& operator=(const ThreadPool&) = delete;  // Присваивание пула запрещено.
+
+        ~ThreadPool();                                      // Деструктор (останавливает и присоединяет потоки).
+
+
+        /* === Общий пул (создаётся при первом обращении, размер - число аппаратных потоков): === */
+        static ThreadPool& global();
+
+
+        /* === Методы для работы с задачами: === */
+        void push(std::function<void()> task);              // Добавление задачи в очередь (её исключения отбрасываются - см. TaskGroup).
+        bool tryRunOne();                                   // Выполнение одной задачи (своей или перехваченной), если она есть.
+
+
+        /* === Методы для получения информации о пуле: === */
+        size_t threadCount() const;                         // Степень параллелизма (рабочие потоки + ожидающий поток).
+    };
+
+
+    class ThreadPool::TaskGroup
+    {
+    private:
+        ThreadPool&         pool;                           // Пул, в котором выполняются задачи группы.
+        std::atomic<size_t> pending{ 0 };                   // Количество незавершенных задач группы.
+        std::exception_ptr  error;                          // Первое исключение, выброшенное задачей.
+        std::mutex          errorMutex;                     // Защита поля error.
+
+    public:
+        explicit TaskGroup(ThreadPool& inputPool) : pool(inputPool) {}
+
+        TaskGroup(const TaskGroup&) = delete;
+        TaskGroup& operator=(const TaskGroup&) = delete;
+
+        // Деструктор дожидается всех задач (задачи ссылаются на группу), исключения при этом игнорируются.
+        ~TaskGroup()
+        {
+            while (pending.load(std::memory_order_acquire) != 0) {
+                if (!pool.tryRunOne()) std::this_thread::yield();
+            }
+        }
+
+        // Запуск задачи в пуле.
+        template<typename F>
+        void run(F&& function)
+        {
+            // Счётчик увеличивается до постановки в очередь (задача может завершиться раньше, чем push вернёт управление),
+            // поэтому если push выбросил исключение (нехватка памяти), задачи в очереди нет и счётчик нужно вернуть.
+            pending.fetch_add(1, std::memory_order_relaxed);
+
+            try
+            {
+                pool.push([this, task = std::forward<F>(function)]() mutable
+                {
+                    try { task(); }
+                    catch (...)
+                    {
+                        std::lock_guard<std::mutex> lock(errorMutex);
+                        if (!error) error = std::current_exception();
+                    }
+
+                    pending.fetch_sub(1, std::memory_order_release);
+                });
+            }
+            catch (...)
+            {
+                pending.fetch_sub(1, std::memory_order_release);
+                throw;
+            }
+        }
+
+        // Ожидание всех задач группы: пока задачи не завершены, текущий поток помогает их выполнять.
+        void wait()
+        {
+            while (pending.load(std::memory_order_acquire) != 0) {
+                if (!pool.tryRunOne()) std::this_thread::yield();
+            }
+
+            if (error)
+            {
+                std::exception_ptr toThrow = error;
+                error = nullptr;
+                std::rethrow_exception(toThrow);
+            }
+        }
+    };
+
+} // namespace Containers.
+
+
+
+/* ... ОПРЕДЕЛЕНИЕ ФУНКЦИОНАЛЬНОСТИ КЛАССА ... */
+namespace Containers
+{
+
+    /* === Вспомогательные методы: === */
+    inline ThreadPool::ThreadContext& ThreadPool::context()
+    {
+        thread_local ThreadContext currentContext;
+        return currentContext;
+    }
+
+    inline void ThreadPool::workerLoop(size_t index)
+    {
+        context().pool = this;
+        context().index = index;
+
+        while (!stopping.load(std::memory_order_acquire))
+        {
+            if (tryRunOne()) { continue; }
+
+            // Задач нет - засыпаю до появления новых (или до остановки пула).
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            wakeUp.wait(lock, [this] {
+                return stopping.load(std::memory_order_acquire) || pendingTasks.load(std::memory_order_acquire) != 0;
+            });
+        }
+    }
+
+    inline bool ThreadPool::tryPop(size_t index, std::function<void()>& task)
+    {
+        TaskQueue& queue = *queues[index];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+
+        if (queue.tasks.empty()) { return false; }
+
+        task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+        return true;
+    }
+
+    inline bool ThreadPool::trySteal(size_t index, std::function<void()>& task)
+    {
+        // Обхожу чужие очереди, начиная со следующей, чтобы потоки не "воровали" у одной и той же жертвы.
+        for (size_t offset = 1; offset <= queues.size(); ++offset)
+        {
+            TaskQueue& queue = *queues[(index + offset) % queues.size()];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+
+            if (!queue.tasks.empty())
+            {
+                task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+
+    /* === Конструкторы и деструктор: === */
+    inline ThreadPool::ThreadPool(size_t threadCount)
+    {
+        // Один из потоков - тот, что ожидает результат (он тоже выполняет задачи), поэтому рабочих на один меньше.
+        const size_t workerCount = (threadCount > 1) ? threadCount - 1 : 0;
+
+        for (size_t i = 0; i <= workerCount; ++i) {
+            queues.push_back(std::make_unique<TaskQueue>());
+        }
+
+        workers.reserve(workerCount);
+        for (size_t i = 0; i < workerCount; ++i) {
+            workers.emplace_back(&ThreadPool::workerLoop, this, i);
+        }
+    }
+
+    inline ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            stopping.store(true, std::memory_order_release);
+        }
+
+        wakeUp.notify_all();
+
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+    }
+
+
+    /* === Общий пул: === */
+    inline ThreadPool& ThreadPool::global()
+    {
+        static ThreadPool pool;
+        return pool;
+    }
+
+
+    /* === Публичные методы для работы с задачами: === */
+    inline void ThreadPool::push(std::function<void()> task)
+    {
+        // Рабочий поток этого пула кладёт задачу в свою очередь, остальные потоки - в общую (последнюю).
+        const ThreadContext& current = context();
+        const size_t index = (current.pool == this) ? current.index : queues.size() - 1;
+
+        /* Счётчик увеличиваю до публикации задачи: иначе другой поток может успеть взять её и уменьшить
+           счётчик раньше, чем он был увеличен (переход через ноль к SIZE_MAX и ложные пробуждения). */
+        pendingTasks.fetch_add(1, std::memory_order_release);
+
+        try
+        {
+            std::lock_guard<std::mutex> lock(queues[index]->mutex);
+            queues[index]->tasks.push_back(std::move(task));
+        }
+        catch (...)
+        {
+            pendingTasks.fetch_sub(1, std::memory_order_relaxed);
+            throw;
+        }
+
+        // Захватываю мьютекс сна, чтобы сигнал не потерялся между проверкой условия и засыпанием потока.
+        { std::lock_guard<std::mutex> lock(sleepMutex); }
+        wakeUp.notify_one();
+    }
+
+    inline bool ThreadPool::tryRunOne()
+    {
+        const ThreadContext& current = context();
+        const size_t index = (current.pool == this) ? current.index : queues.size() - 1;
+
+        std::function<void()> task;
+
+        if (!tryPop(index, task) && !trySteal(index, task)) {
+            return false;
+        }
+
+        pendingTasks.fetch_sub(1, std::memory_order_acq_rel);
+
+        /* Исключение задачи, добавленной напрямую через push(), передать некому: если выпустить его наружу,
+           оно завершит рабочий поток через std::terminate. Поэтому оно перехватывается и отбрасывается;
+           задачи TaskGroup перехватывают исключения сами и повторно выбрасывают их из wait(). */
+        try { task(); }
+        catch (...) {}
+
+        return true;
+    }
+
+
+    /* === Публичные методы для получения информации о пуле: === */
+    inline size_t ThreadPool::threadCount() const { return workers.size() + 1; }
+
+} // namespace Containers.
\ No newline at end of file
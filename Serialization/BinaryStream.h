@@ -0,0 +1,255 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+// Пространство имен Containers предназначено для хранения различных контейнеров.
+namespace Containers
+{
+    /* BinaryWriter - буферизованная запись двоичных данных в поток (std::ostream).
+       Мелкие записи накапливаются в буфере и уходят в поток одним вызовом write, крупные (не меньше буфера)
+       пишутся напрямую, минуя буфер. Поток должен быть открыт в двоичном режиме. */
+    class BinaryWriter
+    {
+    private:
+        /* === Данные записи: === */
+        std::ostream& output;                           // Поток назначения.
+        std::unique_ptr<char[]> buffer;                 // Буфер накопления.
+        size_t capacity;                                // Размер буфера.
+        size_t used = 0;                                // Занятая часть буфера.
+
+
+    public:
+        /* === Размер буфера по умолчанию: === */
+        static constexpr size_t defaultBufferSize = size_t(1) << 20;
+
+
+        /* === Конструкторы и деструктор: === */
+        explicit BinaryWriter(std::ostream& stream, size_t bufferSize = defaultBufferSize);
+        BinaryWriter(const BinaryWriter&) = delete;
+        BinaryWriter& operator=(const BinaryWriter&) = delete;
+        ~BinaryWriter();                                // Деструктор (сбрасывает буфер, ошибки игнорируются).
+
+
+        /* === Методы записи: === */
+        void writeBytes(const void* data, size_t bytes);            // Запись произвольного блока байт.
+
+        template<typename T>
+        void write(const T& value);                                 // Запись тривиально копируемого значения.
+
+        void flush();                                               // Сброс буфера в поток.
+    };
+
+
+    /* BinaryReader - буферизованное чтение двоичных данных из потока (std::istream).
+       Если поток закончился раньше, чем прочитано нужное количество байт, выбрасывается исключение. */
+    class BinaryReader
+    {
+    private:
+        /* === Данные чтения: === */
+        std::istream& input;                            // Поток-источник.
+        std::unique_ptr<char[]> buffer;                 // Буфер предварительного чтения.
+        size_t capacity;                                // Размер буфера.
+        size_t position = 0;                            // Позиция первого непрочитанного байта в буфере.
+        size_t filled   = 0;                            // Количество байт в буфере.
+
+
+    public:
+        /* === Размер буфера по умолчанию: === */
+        static constexpr size_t defaultBufferSize = size_t(1) << 20;
+
+
+        /* === Конструкторы: === */
+        explicit BinaryReader(std::istream& stream, size_t bufferSize = defaultBufferSize);
+        BinaryReader(const BinaryReader&) = delete;
+        BinaryReader& operator=(const BinaryReader&) = delete;
+
+
+        /* === Методы чтения: === */
+        void readBytes(void* data, size_t bytes);                   // Чтение блока байт.
+
+        template<typename T>
+        T read();                                                   // Чтение тривиально копируемого значения.
+    };
+
+
+    /* Serializer - точка расширения: как записать и прочитать элемент типа T.
+       Тривиально копируемые типы записываются побайтово (bulk = true: массив таких элементов
+       пишется и читается одним блоком). Для остальных типов нужна явная специализация вида:
+
+           template<> struct Serializer<MyType>
+           {
+               static constexpr bool bulk = false;
+               static void   write(BinaryWriter& writer, const MyType& value);
+               static MyType read(BinaryReader& reader);
+           };  */
+    template<typename T, typename Enable = void>
+    struct Serializer
+    {
+        static_assert(sizeof(T) == 0, "Error! Specialize Containers::Serializer for this element type.");
+    };
+
+    template<typename T>
+    struct Serializer<T, std::enable_if_t<std::is_trivially_copyable<T>::value>>
+    {
+        static constexpr bool bulk = true;
+
+        static void write(BinaryWriter& writer, const T& value) { writer.write(value); }
+        static T    read(BinaryReader& reader)                  { return reader.read<T>(); }
+    };
+
+    template<>
+    struct Serializer<std::string>
+    {
+        static constexpr bool bulk = false;
+
+        static void write(BinaryWriter& writer, const std::string& value)
+        {
+            writer.write<uint64_t>(value.size());
+            writer.writeBytes(value.data(), value.size());
+        }
+
+        static std::string read(BinaryReader& reader)
+        {
+            /* Длина прочитана из потока и может быть испорчена: строка растёт порциями размером с буфер чтения,
+               поэтому обрезанный поток приводит к "Unexpected end of the stream", а не к огромному выделению памяти. */
+            const size_t length = static_cast<size_t>(reader.read<uint64_t>());
+            std::string value;
+
+            for (size_t done = 0; done < length; )
+            {
+                const size_t part = std::min(BinaryReader::defaultBufferSize, length - done);
+
+                value.resize(done + part);
+                reader.readBytes(&value[done], part);
+                done += part;
+            }
+
+            return value;
+        }
+    };
+
+} // namespace Containers.
+
+
+
+/* ... ОПРЕДЕЛЕНИЕ ФУНКЦИОНАЛЬНОСТИ ... */
+namespace Containers
+{
+
+    /* === BinaryWriter: === */
+    inline BinaryWriter::BinaryWriter(std::ostream& stream, size_t bufferSize)
+        : output(stream), buffer(new char[bufferSize == 0 ? 1 : bufferSize]), capacity(bufferSize == 0 ? 1 : bufferSize) {}
+
+    inline BinaryWriter::~BinaryWriter()
+    {
+        // Деструктор не должен выбрасывать исключений - для проверки ошибок нужно вызвать flush() явно.
+        try { flush(); }
+        catch (...) {}
+    }
+
+    inline void BinaryWriter::writeBytes(const void* data, size_t bytes)
+    {
+        // Блок не помещается в остаток буфера - сбрасываю буфер.
+        if (used + bytes > capacity) { flush(); }
+
+        // Крупный блок пишу напрямую, без лишнего копирования в буфер.
+        if (bytes >= capacity)
+        {
+            output.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+
+            if (!output) {
+                throw std::runtime_error("Error! Failed to write to the stream.");
+            }
+
+            return;
+        }
+
+        std::memcpy(buffer.get() + used, data, bytes);
+        used += bytes;
+    }
+
+    template<typename T>
+    void BinaryWriter::write(const T& value)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "Error! Only trivially copyable values can be written directly.");
+        writeBytes(&value, sizeof(T));
+    }
+
+    inline void BinaryWriter::flush()
+    {
+        if (used != 0)
+        {
+            output.write(buffer.get(), static_cast<std::streamsize>(used));
+            used = 0;
+        }
+
+        output.flush();
+
+        if (!output) {
+            throw std::runtime_error("Error! Failed to write to the stream.");
+        }
+    }
+
+
+    /* === BinaryReader: === */
+    inline BinaryReader::BinaryReader(std::istream& stream, size_t bufferSize)
+        : input(stream), buffer(new char[bufferSize == 0 ? 1 : bufferSize]), capacity(bufferSize == 0 ? 1 : bufferSize) {}
+
+    inline void BinaryReader::readBytes(void* data, size_t bytes)
+    {
+        char* destination = static_cast<char*>(data);
+
+        // 1. Забираю то, что уже есть в буфере.
+        const size_t buffered = std::min(bytes, filled - position);
+        std::memcpy(destination, buffer.get() + position, buffered);
+
+        position    += buffered;
+        destination += buffered;
+        bytes       -= buffered;
+
+        if (bytes == 0) { return; }
+
+        // 2. Крупный остаток читаю напрямую в место назначения.
+        if (bytes >= capacity)
+        {
+            input.read(destination, static_cast<std::streamsize>(bytes));
+
+            if (static_cast<size_t>(input.gcount()) != bytes) {
+                throw std::runtime_error("Error! Unexpected end of the stream.");
+            }
+
+            return;
+        }
+
+        // 3. Иначе заполняю буфер заново (сколько получится) и беру из него остаток.
+        input.read(buffer.get(), static_cast<std::streamsize>(capacity));
+        filled   = static_cast<size_t>(input.gcount());
+        position = 0;
+
+        if (filled < bytes) {
+            throw std::runtime_error("Error! Unexpected end of the stream.");
+        }
+
+        std::memcpy(destination, buffer.get(), bytes);
+        position = bytes;
+    }
+
+    template<typename T>
+    T BinaryReader::read()
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "Error! Only trivially copyable values can be read directly.");
+
+        T value;
+        readBytes(&value, sizeof(T));
+        return value;
+    }
+
+} // namespace Containers.
@@ -0,0 +1,260 @@
+#pragma once
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "BinaryStream.h"
+#include "../Vector/Vector.h"
+#include "../LinkedList/LinkedList.h"
+#include "../BinarySearchTree/BinarySearchTree.h"
+
+// Пространство имен Containers предназначено для хранения различных контейнеров.
+namespace Containers
+{
+    /* Двоичный формат контейнеров (версия 1).
+       Каждый контейнер записывается как заголовок фиксированного размера и следующие за ним элементы:
+         - элементы с Serializer<T>::bulk (тривиально копируемые) - одним непрерывным блоком байт;
+         - остальные - по одному, через Serializer<T>::write.
+       Дерево записывается в порядке возрастания, а при загрузке сразу строится сбалансированным (O(n)).
+       Числа записываются в порядке байт текущей машины - файлы переносимы между машинами одной архитектуры.
+       Несколько контейнеров можно записать в один поток подряд и прочитать в том же порядке. */
+    namespace Serialization
+    {
+        /* === Версия формата и вид контейнера: === */
+        constexpr uint16_t formatVersion = 1;
+
+        enum class ContainerKind : uint8_t { Vector = 1, LinkedList = 2, BinarySearchTree = 3 };
+
+
+        /* === Заголовок контейнера: === */
+        struct Header
+        {
+            char          signature[4];                 // Сигнатура "CNTB".
+            uint16_t      version;                      // Версия формата.
+            ContainerKind kind;                         // Вид контейнера.
+            uint8_t       bulk;                         // Записаны ли элементы одним блоком.
+            uint32_t      elementSize;                  // sizeof(T) при записи (проверяется для блочного формата).
+            uint32_t      reserved;                     // Зарезервировано.
+            uint64_t      count;                        // Количество элементов.
+        };
+
+        static_assert(sizeof(Header) == 24, "Error! Unexpected serialization header size.");
+
+
+        template<typename T>
+        void writeHeader(BinaryWriter& writer, ContainerKind kind, size_t count);   // Запись заголовка.
+
+        template<typename T>
+        size_t readHeader(BinaryReader& reader, ContainerKind kind);                // Чтение и проверка заголовка, возвращает количество элементов.
+
+        template<typename T>
+        constexpr size_t chunkElements();                                           // Количество элементов в одной порции чтения.
+
+        template<typename T, typename Elements>
+        void readBulk(BinaryReader& reader, Elements& elements, size_t count);      // Блочное чтение count элементов порциями.
+
+    } // namespace Serialization.
+
+
+    /* === Запись контейнеров: === */
+    template<typename T> void save(BinaryWriter& writer, const Vector<T>& vector);
+    template<typename T> void save(BinaryWriter& writer, const LinkedList<T>& list);
+    template<typename T> void save(BinaryWriter& writer, const BinarySearchTree<T>& tree);
+
+
+    /* === Загрузка контейнеров (прежнее содержимое заменяется): === */
+    template<typename T> void load(BinaryReader& reader, Vector<T>& vector);
+    template<typename T> void load(BinaryReader& reader, LinkedList<T>& list);
+    template<typename T> void load(BinaryReader& reader, BinarySearchTree<T>& tree);
+
+
+    /* === Запись в файл и загрузка из файла: === */
+    template<typename Container> void saveToFile(const std::string& path, const Container& container);
+    template<typename Container> void loadFromFile(const std::string& path, Container& container);
+
+} // namespace Containers.
+
+
+
+/* ... ОПРЕДЕЛЕНИЕ ФУНКЦИОНАЛЬНОСТИ ... */
+namespace Containers
+{
+    namespace Serialization
+    {
+
+        template<typename T>
+        void writeHeader(BinaryWriter& writer, ContainerKind kind, size_t count)
+        {
+            Header header{ { 'C', 'N', 'T', 'B' }, formatVersion, kind, Serializer<T>::bulk, sizeof(T), 0, count };
+            writer.write(header);
+        }
+
+        template<typename T>
+        size_t readHeader(BinaryReader& reader, ContainerKind kind)
+        {
+            const Header header = reader.read<Header>();
+
+            if (header.signature[0] != 'C' || header.signature[1] != 'N' || header.signature[2] != 'T' || header.signature[3] != 'B') {
+                throw std::runtime_error("Error! The stream does not contain a serialized container.");
+            }
+            if (header.version > formatVersion) {
+                throw std::runtime_error("Error! The container was written by a newer format version.");
+            }
+            if (header.kind != kind) {
+                throw std::runtime_error("Error! The stream contains a container of a different kind.");
+            }
+            if (header.bulk != Serializer<T>::bulk || (header.bulk && header.elementSize != sizeof(T))) {
+                throw std::runtime_error("Error! The stored element type does not match the container element type.");
+            }
+
+            return static_cast<size_t>(header.count);
+        }
+
+        /* Количество элементов из заголовка ничем не подтверждено (файл может быть обрезан или испорчен),
+           поэтому память заранее выделяется не больше чем на одну порцию размером с буфер чтения,
+           а дальше растёт по мере того, как данные действительно прочитаны. */
+        template<typename T>
+        constexpr size_t chunkElements() { return std::max<size_t>(1, BinaryReader::defaultBufferSize / sizeof(T)); }
+
+        template<typename T, typename Elements>
+        void readBulk(BinaryReader& reader, Elements& elements, size_t count)
+        {
+            // При обрыве потока readBytes выбрасывает "Unexpected end of the stream" после первой же недочитанной порции.
+            for (size_t done = 0; done < count; )
+            {
+                const size_t part = std::min(chunkElements<T>(), count - done);
+
+                elements.resize(done + part);
+                reader.readBytes(&elements[done], part * sizeof(T));
+                done += part;
+            }
+        }
+
+    } // namespace Serialization.
+
+
+    /* === Запись контейнеров: === */
+    template<typename T>
+    void save(BinaryWriter& writer, const Vector<T>& vector)
+    {
+        Serialization::writeHeader<T>(writer, Serialization::ContainerKind::Vector, vector.size());
+
+        // Элементы вектора лежат подряд - тривиально копируемые пишу одним блоком.
+        if constexpr (Serializer<T>::bulk) {
+            writer.writeBytes(&*vector.begin(), vector.size() * sizeof(T));
+        }
+        else
+        {
+            for (const T& value : vector) {
+                Serializer<T>::write(writer, value);
+            }
+        }
+    }
+
+    template<typename T>
+    void save(BinaryWriter& writer, const LinkedList<T>& list)
+    {
+        Serialization::writeHeader<T>(writer, Serialization::ContainerKind::LinkedList, list.size());
+
+        // Узлы списка разбросаны по памяти - пишу по одному (запись всё равно идёт через буфер).
+        for (const T& value : list) {
+            Serializer<T>::write(writer, value);
+        }
+    }
+
+    template<typename T>
+    void save(BinaryWriter& writer, const BinarySearchTree<T>& tree)
+    {
+        Serialization::writeHeader<T>(writer, Serialization::ContainerKind::BinarySearchTree, tree.size());
+
+        // Обход итератором даёт элементы в порядке возрастания.
+        for (const T& value : tree) {
+            Serializer<T>::write(writer, value);
+        }
+    }
+
+
+    /* === Загрузка контейнеров: === */
+    template<typename T>
+    void load(BinaryReader& reader, Vector<T>& vector)
+    {
+        const size_t count = Serialization::readHeader<T>(reader, Serialization::ContainerKind::Vector);
+
+        vector.clear();
+
+        if constexpr (Serializer<T>::bulk) {
+            Serialization::readBulk<T>(reader, vector, count);
+        }
+        else
+        {
+            vector.reserve(std::min(count, Serialization::chunkElements<T>()));
+
+            for (size_t i = 0; i < count; ++i) {
+                vector.pushBack(Serializer<T>::read(reader));
+            }
+        }
+    }
+
+    template<typename T>
+    void load(BinaryReader& reader, LinkedList<T>& list)
+    {
+        const size_t count = Serialization::readHeader<T>(reader, Serialization::ContainerKind::LinkedList);
+
+        list.clear();
+
+        for (size_t i = 0; i < count; ++i) {
+            list.pushBack(Serializer<T>::read(reader));
+        }
+    }
+
+    template<typename T>
+    void load(BinaryReader& reader, BinarySearchTree<T>& tree)
+    {
+        const size_t count = Serialization::readHeader<T>(reader, Serialization::ContainerKind::BinarySearchTree);
+
+        std::vector<T> sorted;
+
+        if constexpr (Serializer<T>::bulk) {
+            Serialization::readBulk<T>(reader, sorted, count);
+        }
+        else
+        {
+            sorted.reserve(std::min(count, Serialization::chunkElements<T>()));
+
+            for (size_t i = 0; i < count; ++i) {
+                sorted.push_back(Serializer<T>::read(reader));
+            }
+        }
+
+        // Значения записаны по возрастанию - дерево строится сразу сбалансированным, без n вставок.
+        tree.assignSorted(sorted);
+    }
+
+
+    /* === Запись в файл и загрузка из файла: === */
+    template<typename Container>
+    void saveToFile(const std::string& path, const Container& container)
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            throw std::runtime_error("Error! Failed to open the file for writing.");
+        }
+
+        BinaryWriter writer(file);
+        save(writer, container);
+        writer.flush();
+    }
+
+    template<typename Container>
+    void loadFromFile(const std::string& path, Container& container)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file) {
+            throw std::runtime_error("Error! Failed to open the file for reading.");
+        }
+
+        BinaryReader reader(file);
+        load(reader, container);
+    }
+
+} // namespace Containers.
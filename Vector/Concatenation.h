@@ -0,0 +1,141 @@
+#pragma once
+#include <cstddef>
+#include <utility>
+#include "GrowthPolicy.h"
+
+// Пространство имен Containers предназначено для хранения различных контейнеров.
+namespace Containers
+{
+    template<typename T> class Vector;
+
+
+    /* Concatenation - ленивое выражение "сумма векторов", которое возвращает operator+.
+       Цепочка a + b + c + d не создаёт промежуточных векторов: выражение лишь запоминает операнды,
+       а при преобразовании в Vector вычисляет итоговый размер, выделяет память один раз (ровно под
+       результат) и копирует каждый элемент ровно один раз. Если самый левый операнд - временный вектор
+       (std::move(a) + b + ...), его буфер переиспользуется и дорастает до итогового размера на месте.
+       Важно! Выражение хранит ссылки на операнды, поэтому его нужно сразу превращать в Vector,
+       а не сохранять через auto (сохранённое выражение при вычислении копирует все операнды). */
+    template<typename T, typename Left, typename Right>
+    class Concatenation;
+
+
+    // Пространство имен Concat содержит "листья" выражения - ссылки на векторы-операнды.
+    namespace Concat
+    {
+        /* === Ссылка на вектор-операнд: === */
+        template<typename T>
+        struct Reference
+        {
+            const Vector<T>* vector;
+
+            size_t     size() const { return vector->size(); }
+            Vector<T>* base() const { return nullptr; }
+            void       appendTo(Vector<T>& result) const { result.append(vector->begin(), vector->end()); }
+        };
+
+        /* === Ссылка на временный вектор (его буфер может стать буфером результата): === */
+        template<typename T>
+        struct Owned
+        {
+            Vector<T>* vector;
+
+            size_t     size() const { return vector->size(); }
+            Vector<T>* base() const { return vector; }
+
+            void appendTo(Vector<T>& result) const
+            {
+                // Если результат строится прямо в этом векторе - его элементы уже на месте.
+                if (vector != &result) { result.append(vector->begin(), vector->end()); }
+            }
+        };
+    }
+
+
+    template<typename T, typename Left, typename Right>
+    class Concatenation
+    {
+    private:
+        /* === Операнды выражения: === */
+        Left  left;                                     // Левая часть (лист или вложенное выражение).
+        Right right;                                    // Правая часть (лист или вложенное выражение).
+
+
+    public:
+        Concatenation(Left leftOperand, Right rightOperand) : left(leftOperand), right(rightOperand) {}
+
+
+        /* === Методы, общие для всех узлов выражения: === */
+        size_t     size() const { return left.size() + right.size(); } // Итоговое количество элементов.
+        Vector<T>* base() const { return left.base(); }                 // Временный вектор в самой левой позиции (или nullptr).
+
+        void appendTo(Vector<T>& result) const                          // Копирование всех элементов в конец result.
+        {
+            left.appendTo(result);
+            right.appendTo(result);
+        }
+
+
+        /* === Вычисление выражения: === */
+        operator Vector<T>() const &&                                   // Временное выражение (обычный случай).
+        {
+            const size_t total = size();
+
+            /* Если слева стоит временный вектор - дорастаю его до итогового размера (одно перевыделение,
+               realloc по возможности на месте) и дописываю остальные операнды прямо в него. */
+            if (Vector<T>* reused = base())
+            {
+                reused->reserve(total);
+                appendTo(*reused);
+                return std::move(*reused);
+            }
+
+            Vector<T> result(GrowthPolicy::doubling(total));
+            appendTo(result);
+            return result;
+        }
+
+        operator Vector<T>() const &                                    // Сохранённое выражение: все элементы копируются.
+        {
+            Vector<T> result(GrowthPolicy::doubling(size()));
+
+            left.appendTo(result);
+            right.appendTo(result);
+            return result;
+        }
+    };
+
+
+    /* === Операторы сложения векторов и выражений: === */
+    template<typename T>
+    Concatenation<T, Concat::Reference<T>, Concat::Reference<T>> operator+(const Vector<T>& left, const Vector<T>& right) {
+        return { Concat::Reference<T>{ &left }, Concat::Reference<T>{ &right } };
+    }
+
+    template<typename T>
+    Concatenation<T, Concat::Owned<T>, Concat::Reference<T>> operator+(Vector<T>&& left, const Vector<T>& right) {
+        return { Concat::Owned<T>{ &left }, Concat::Reference<T>{ &right } };
+    }
+
+    template<typename T, typename L, typename R>
+    Concatenation<T, Concatenation<T, L, R>, Concat::Reference<T>> operator+(Concatenation<T, L, R>&& left, const Vector<T>& right) {
+        return { std::move(left), Concat::Reference<T>{ &right } };
+    }
+
+    template<typename T, typename L, typename R>
+    Concatenation<T, Concat::Reference<T>, Concatenation<T, L, R>> operator+(const Vector<T>& left, Concatenation<T, L, R>&& right) {
+        return { Concat::Reference<T>{ &left }, std::move(right) };
+    }
+
+    template<typename T, typename L, typename R>
+    Concatenation<T, Concat::Owned<T>, Concatenation<T, L, R>> operator+(Vector<T>&& left, Concatenation<T, L, R>&& right) {
+        return { Concat::Owned<T>{ &left }, std::move(right) };
+    }
+
+    template<typename T, typename L1, typename R1, typename L2, typename R2>
+    Concatenation<T, Concatenation<T, L1, R1>, Concatenation<T, L2, R2>>
+    operator+(Concatenation<T, L1, R1>&& left, Concatenation<T, L2, R2>&& right) {
+        return { std::move(left), std::move(right) };
+    }
+
+} // namespace Containers.
\ No newline at end of file
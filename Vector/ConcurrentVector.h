@@ -0,0 +1,444 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include "Vector.h"
+
+// Пространство имен Containers предназначено для хранения различных контейнеров.
+namespace Containers
+{
+    /* ConcurrentVector - вектор для одновременного добавления элементов из многих потоков.
+       Элементы хранятся в сегментах, размеры которых - степени двойки (32, 64, 128, ...), поэтому
+       при росте вектора уже добавленные элементы никогда не перемещаются и ссылки на них остаются валидными.
+       Поток резервирует индекс атомарным увеличением размера и создаёт элемент в своей ячейке, не блокируя других.
+       Новый сегмент устанавливается сравнением с обменом: если его одновременно выделили несколько потоков,
+       проигравшие освобождают свои копии (обычно сегмент выделяется заранее, с середины предыдущего, и гонки нет).
+       Готовность элемента отмечается состоянием ячейки, поэтому чтение опубликованных элементов тоже без блокировок.
+       Ячейка, в которой конструктор выбросил исключение, помечается как испорченная и навсегда остаётся пустой:
+       итератор и toVector() пропускают такие ячейки, как и ещё не опубликованные.
+       Важно! Методы clear(), reserve() и перемещение не потокобезопасны относительно добавления. */
+    template<typename T>
+    class ConcurrentVector
+    {
+    private:
+        /* === Состояния ячейки: === */
+        enum SlotState : unsigned char
+        {
+            Empty,                                              // Элемент ещё создаётся (или ячейка не зарезервирована).
+            Published,                                          // Элемент создан и доступен для чтения.
+            Failed                                              // Конструктор выбросил исключение, элемента нет.
+        };
+
+        /* === Ячейка хранения элемента: === */
+        struct Slot
+        {
+            std::atomic<unsigned char> state{ Empty };          // Состояние ячейки.
+            alignas(T) unsigned char storage[sizeof(T)];        // Память под элемент.
+
+            T* object() { return reinterpret_cast<T*>(storage); }
+        };
+
+
+        /* === Параметры сегментов: === */
+        static constexpr size_t firstSegmentShift = 5;                          // Первый сегмент - 32 элемента.
+        static constexpr size_t firstSegmentSize  = size_t(1) << firstSegmentShift;
+        static constexpr size_t segmentCount      = 64 - firstSegmentShift;    // Сегментов хватает на любой size_t индекс.
+
+
+        /* === Данные вектора: === */
+        /* Таблица сегментов почти только читается, а счётчики изменяются при каждом добавлении, поэтому
+           каждый счётчик лежит в своей кэш-линии: иначе запись счётчика выбивала бы таблицу из кэша всех ядер. */
+        static constexpr size_t cacheLine = 64;
+
+        alignas(cacheLine) std::atomic<Slot*>  segments[segmentCount] = {};    // Сегменты (nullptr - ещё не выделен).
+        alignas(cacheLine) std::atomic<size_t> currSize{ 0 };                  // Количество зарезервированных ячеек.
+        alignas(cacheLine) std::atomic<size_t> publishedCount{ 0 };            // Количество опубликованных элементов.
+
+
+        /* === Вспомогательные методы: === */
+        static size_t segmentOf(size_t index);                  // Номер сегмента, в котором лежит индекс.
+        static size_t segmentBase(size_t segment);              // Индекс первого элемента сегмента.
+        static size_t segmentSize(size_t segment);              // Количество элементов в сегменте.
+
+        Slot* publishedSegment(size_t segment) const;           // Сегмент или nullptr, если он ещё не выделен.
+        Slot* acquireSegment(size_t segment);                   // Сегмент (выделяется при первом обращении).
+        Slot& slotAt(size_t index) const;                       // Ячейка по индексу (сегмент должен существовать).
+        unsigned char stateOf(size_t index) const;              // Состояние ячейки (Empty, если её сегмента ещё нет).
+
+        template<typename... Args>
+        size_t construct(Args&&... args);                       // Резервирование ячейки и создание в ней элемента.
+        void  destroyAll();                                     // Уничтожение элементов и освобождение сегментов.
+
+
+    public:
+        /* === Однонаправленный итератор по опубликованным элементам (на момент вызова begin()): === */
+        class Iterator;
+
+
+        /* === Методы для получения итераторов на начало и конец вектора: === */
+        Iterator begin() const;
+        Iterator end()   const;
+
+
+        /* === Конструкторы и деструктор: === */
+        ConcurrentVector() = default;                           // Конструктор по умолчанию (без выделения памяти).
+        ConcurrentVector(ConcurrentVector&& other) noexcept;    // Конструктор перемещения.
+
+        ConcurrentVector(const ConcurrentVector&) = delete;             // Копирование запрещено.
+        ConcurrentVector& operator=(const ConcurrentVector&) = delete;  // Присваивание копированием запрещено.
+        ConcurrentVector& operator=(ConcurrentVector&& other) noexcept; // Оператор присваивания перемещением.
+
+        ~ConcurrentVector();                                    // Деструктор.
+
+
+        /* === Методы для добавления элементов (потокобезопасны): === */
+        size_t pushBack(const T& value);                        // Добавление копии элемента, возвращает его индекс.
+        size_t pushBack(T&& value);                             // Добавление элемента перемещением, возвращает его индекс.
+
+        template<typename... Args>
+        T&     emplaceBack(Args&&... args);                     // Создание элемента на месте, возвращает ссылку на него.
+
+
+        /* === Методы для управления ёмкостью (не потокобезопасны относительно добавления): === */
+        void reserve(size_t newCapacity);                       // Заблаговременное выделение сегментов.
+        void clear();                                           // Удаление всех элементов и освобождение памяти.
+
+
+        /* === Методы доступа к элементам вектора (потокобезопасны для опубликованных элементов): === */
+        T&   at(size_t index);                                  // Обращение к элементу с проверкой границ и публикации.
+        T&   operator[](size_t index);                          // Обращение к элементу без проверки границ (только проверка публикации).
+        bool isPublished(size_t index) const;                   // Создан ли элемент с данным индексом.
+
+
+        /* === Методы для получения информации о векторе: === */
+        bool   isEmpty()  const;                                // Проверка на пустоту вектора.
+        size_t capacity() const;                                // Количество ячеек в выделенных сегментах.
+        size_t size()     const;                                // Количество опубликованных элементов.
+
+
+        /* === Преобразование в обычный вектор (после завершения добавлений): === */
+        Vector<T> toVector() const;
+    };
+
+} // namespace Containers.
+
+
+
+/* ... ОПРЕДЕЛЕНИЕ ФУНКЦИОНАЛЬНОСТИ КЛАССА ... */
+namespace Containers
+{
+
+    /* === Вспомогательные защищенные методы: === */
+    template<typename T>
+    size_t ConcurrentVector<T>::segmentOf(size_t index)
+    {
+        /* Сегмент k занимает индексы [32 * (2^k - 1), 32 * (2^(k+1) - 1)), поэтому его номер -
+           это позиция старшего бита числа index + 32 за вычетом 5. */
+        const uint64_t shifted = static_cast<uint64_t>(index) + firstSegmentSize;
+        return static_cast<size_t>(63 - __builtin_clzll(shifted)) - firstSegmentShift;
+    }
+
+    template<typename T>
+    size_t ConcurrentVector<T>::segmentBase(size_t segment) { return (firstSegmentSize << segment) - firstSegmentSize; }
+
+    template<typename T>
+    size_t ConcurrentVector<T>::segmentSize(size_t segment) { return firstSegmentSize << segment; }
+
+    template<typename T>
+    typename ConcurrentVector<T>::Slot* ConcurrentVector<T>::publishedSegment(size_t segment) const {
+        return segments[segment].load(std::memory_order_acquire);
+    }
+
+    template<typename T>
+    typename ConcurrentVector<T>::Slot* ConcurrentVector<T>::acquireSegment(size_t segment)
+    {
+        Slot* current = segments[segment].load(std::memory_order_acquire);
+        if (current != nullptr) { return current; }
+
+        /* Сегмента нет: выделяю свою копию и пытаюсь установить её. Ни один поток не ждёт другого - если
+           установить успел кто-то ещё, моя копия освобождается, а используется уже установленный сегмент. */
+        Slot* fresh = new Slot[segmentSize(segment)];
+
+        if (!segments[segment].compare_exchange_strong(current, fresh, std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+            delete[] fresh;
+            return current;
+        }
+
+        return fresh;
+    }
+
+    template<typename T>
+    typename ConcurrentVector<T>::Slot& ConcurrentVector<T>::slotAt(size_t index) const
+    {
+        const size_t segment = segmentOf(index);
+        return segments[segment].load(std::memory_order_acquire)[index - segmentBase(segment)];
+    }
+
+    template<typename T>
+    unsigned char ConcurrentVector<T>::stateOf(size_t index) const
+    {
+        if (index >= currSize.load(std::memory_order_acquire)) { return Empty; }
+
+        // Индекс уже зарезервирован, но сегмент мог ещё не успеть появиться.
+        const size_t segment = segmentOf(index);
+        Slot* slots = publishedSegment(segment);
+
+        return (slots != nullptr) ? slots[index - segmentBase(segment)].state.load(std::memory_order_acquire) : Empty;
+    }
+
+    template<typename T>
+    void ConcurrentVector<T>::destroyAll()
+    {
+        const size_t reserved = currSize.load(std::memory_order_acquire);
+
+        for (size_t segment = 0; segment < segmentCount; ++segment)
+        {
+            Slot* slots = segments[segment].load(std::memory_order_acquire);
+            if (slots == nullptr) { continue; }
+
+            // Уничтожаю только опубликованные элементы: ячейка, где конструктор выбросил исключение, пуста.
+            if constexpr (!std::is_trivially_destructible<T>::value)
+            {
+                const size_t base = segmentBase(segment);
+                for (size_t i = 0; i < segmentSize(segment) && base + i < reserved; ++i) {
+                    if (slots[i].state.load(std::memory_order_relaxed) == Published) { slots[i].object()->~T(); }
+                }
+            }
+
+            delete[] slots;
+            segments[segment].store(nullptr, std::memory_order_relaxed);
+        }
+
+        currSize.store(0, std::memory_order_release);
+        publishedCount.store(0, std::memory_order_release);
+    }
+
+
+    template<typename T>
+    template<typename... Args>
+    size_t ConcurrentVector<T>::construct(Args&&... args)
+    {
+        // 1. Резервирую индекс: после fetch_add ячейка принадлежит только этому потоку.
+        const size_t index = currSize.fetch_add(1, std::memory_order_relaxed);
+        const size_t segment = segmentOf(index);
+
+        // 2. Получаю (или выделяю) сегмент и создаю элемент в своей ячейке.
+        const size_t offset = index - segmentBase(segment);
+        Slot& slot = acquireSegment(segment)[offset];
+
+        /* Поток, получивший середину сегмента (такой поток ровно один), заранее выделяет следующий сегмент.
+           Иначе к его границе подходят сразу все производители и простаивают, пока один из них выделяет сегмент.
+           Это только оптимизация: при нехватке памяти сегмент выделит тот, кому он понадобится. */
+        if (offset == segmentSize(segment) / 2 && segment + 1 < segmentCount)
+        {
+            try { acquireSegment(segment + 1); }
+            catch (const std::bad_alloc&) {}
+        }
+
+        /* Индекс уже не вернуть, поэтому при исключении конструктора ячейка помечается как испорченная,
+           чтобы читатели не ждали её публикации и не обращались к несозданному элементу. */
+        try { new (slot.storage) T(std::forward<Args>(args)...); }
+        catch (...)
+        {
+            slot.state.store(Failed, std::memory_order_release);
+            throw;
+        }
+
+        // 3. Публикую элемент: release гарантирует, что читатель увидит его полностью созданным.
+        slot.state.store(Published, std::memory_order_release);
+        publishedCount.fetch_add(1, std::memory_order_release);
+        return index;
+    }
+
+
+    /* === Описание структуры итератора: === */
+    template<typename T>
+    class ConcurrentVector<T>::Iterator
+    {
+    private:
+        /* Вектор, индекс текущего элемента и граница обхода (количество ячеек, зарезервированных к моменту begin()).
+           Неопубликованные и испорченные ячейки пропускаются, поэтому итератор только однонаправленный. */
+        const ConcurrentVector* vector;
+        size_t currIndex;
+        size_t limit;
+
+        // Переход к ближайшему опубликованному элементу (или к границе обхода).
+        void skipUnpublished() {
+            while (currIndex < limit && vector->stateOf(currIndex) != Published) { ++currIndex; }
+        }
+
+        // Итератор дошёл до своей границы и равен любому другому такому итератору.
+        bool isExhausted() const { return currIndex >= limit; }
+
+    public:
+        // Информация об итераторе для совместимости со стандартными алгоритмами:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = T*;
+        using reference         = T&;
+
+        // Пользовательский конструктор:
+        Iterator(const ConcurrentVector* inputVector, size_t index, size_t inputLimit)
+            : vector(inputVector), currIndex(index), limit(inputLimit) { skipUnpublished(); }
+
+        // Операторы разыменования:
+        reference operator*()  const { return *vector->slotAt(currIndex).object(); }
+        pointer   operator->() const { return vector->slotAt(currIndex).object(); }
+
+        // Операторы инкрементирования:
+        Iterator& operator++()    { ++currIndex; skipUnpublished(); return *this; }
+        Iterator  operator++(int) { Iterator temp = *this; ++(*this); return temp; }
+
+        /* Операторы сравнения: end(), полученный позже begin(), может иметь большую границу,
+           поэтому все итераторы, дошедшие до своей границы, считаются равными. */
+        bool operator==(const Iterator& other) const {
+            return (this->isExhausted() && other.isExhausted()) || currIndex == other.currIndex;
+        }
+        bool operator!=(const Iterator& other) const { return !(*this == other); }
+    };
+
+
+    /* === Публичные методы для получения итераторов на начало и конец вектора: === */
+    template<typename T>
+    typename ConcurrentVector<T>::Iterator ConcurrentVector<T>::begin() const {
+        return Iterator(this, 0, currSize.load(std::memory_order_acquire));
+    }
+
+    template<typename T>
+    typename ConcurrentVector<T>::Iterator ConcurrentVector<T>::end() const {
+        const size_t reserved = currSize.load(std::memory_order_acquire);
+        return Iterator(this, reserved, reserved);
+    }
+
+
+    /* === Конструкторы и деструктор: === */
+    template<typename T>
+    ConcurrentVector<T>::ConcurrentVector(ConcurrentVector&& other) noexcept(true)
+    {
+        for (size_t segment = 0; segment < segmentCount; ++segment) {
+            segments[segment].store(other.segments[segment].exchange(nullptr));
+        }
+
+        currSize.store(other.currSize.exchange(0));
+        publishedCount.store(other.publishedCount.exchange(0));
+    }
+
+    template<typename T>
+    ConcurrentVector<T>& ConcurrentVector<T>::operator=(ConcurrentVector&& other) noexcept(true)
+    {
+        if (this != &other)
+        {
+            destroyAll();
+
+            for (size_t segment = 0; segment < segmentCount; ++segment) {
+                segments[segment].store(other.segments[segment].exchange(nullptr));
+            }
+
+            currSize.store(other.currSize.exchange(0));
+            publishedCount.store(other.publishedCount.exchange(0));
+        }
+
+        return *this;
+    }
+
+    template<typename T>
+    ConcurrentVector<T>::~ConcurrentVector() { destroyAll(); }
+
+
+    /* === Публичные методы для добавления элементов: === */
+    template<typename T>
+    size_t ConcurrentVector<T>::pushBack(const T& value) { return this->construct(value); }
+
+    template<typename T>
+    size_t ConcurrentVector<T>::pushBack(T&& value) { return this->construct(std::move(value)); }
+
+    template<typename T>
+    template<typename... Args>
+    T& ConcurrentVector<T>::emplaceBack(Args&&... args) {
+        return *slotAt(this->construct(std::forward<Args>(args)...)).object();
+    }
+
+
+    /* === Публичные методы для управления ёмкостью: === */
+    template<typename T>
+    void ConcurrentVector<T>::reserve(size_t newCapacity)
+    {
+        if (newCapacity == 0) { return; }
+
+        const size_t lastSegment = segmentOf(newCapacity - 1);
+        for (size_t segment = 0; segment <= lastSegment; ++segment) { acquireSegment(segment); }
+    }
+
+    template<typename T>
+    void ConcurrentVector<T>::clear() { destroyAll(); }
+
+
+    /* === Публичные методы доступа к элементам вектора: === */
+    template<typename T>
+    T& ConcurrentVector<T>::at(size_t index)
+    {
+        if (index >= currSize.load(std::memory_order_acquire)) {
+            throw std::out_of_range("Error! Index is out of range.");
+        }
+
+        const unsigned char state = stateOf(index);
+        if (state == Failed) {
+            throw std::runtime_error("Error! Element construction failed.");
+        }
+        if (state != Published) {
+            throw std::runtime_error("Error! Element is not published yet.");
+        }
+
+        return *slotAt(index).object();
+    }
+
+    template<typename T>
+    T& ConcurrentVector<T>::operator[](size_t index)
+    {
+        // Сегмент ячейки может ещё не существовать, а элемент - не быть созданным: такое обращение недопустимо.
+        if (stateOf(index) != Published) {
+            throw std::runtime_error("Error! Element is not published yet.");
+        }
+
+        return *slotAt(index).object();
+    }
+
+    template<typename T>
+    bool ConcurrentVector<T>::isPublished(size_t index) const { return stateOf(index) == Published; }
+
+
+    /* === Публичные методы для получения информации о векторе: === */
+    template<typename T> bool   ConcurrentVector<T>::isEmpty() const { return this->size() == 0; }
+    template<typename T> size_t ConcurrentVector<T>::size()    const { return publishedCount.load(std::memory_order_acquire); }
+
+    template<typename T>
+    size_t ConcurrentVector<T>::capacity() const
+    {
+        // Ёмкость - конец последнего выделенного сегмента (сегменты выделяются по мере роста индексов).
+        size_t result = 0;
+        for (size_t segment = 0; segment < segmentCount; ++segment) {
+            if (publishedSegment(segment) != nullptr) { result = segmentBase(segment + 1); }
+        }
+
+        return result;
+    }
+
+
+    /* === Преобразование в обычный вектор: === */
+    template<typename T>
+    Vector<T> ConcurrentVector<T>::toVector() const
+    {
+        Vector<T> result;
+        result.reserve(this->size());
+
+        // Обхожу все зарезервированные ячейки, пропуская неопубликованные и испорченные.
+        const size_t reserved = currSize.load(std::memory_order_acquire);
+        for (size_t i = 0; i < reserved; ++i) {
+            if (this->isPublished(i)) { result.pushBack(*slotAt(i).object()); }
+        }
+
+        return result;
+    }
+
+} // namespace Containers.
\ No newline at end of file
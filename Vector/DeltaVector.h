@@ -0,0 +1,396 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include "PackedVector.h"
+
+// Пространство имен Containers предназначено для хранения различных контейнеров.
+namespace Containers
+{
+    /* DeltaVector - сжатый вектор неубывающей последовательности беззнаковых целых (отсортированные идентификаторы).
+       Значения разбиты на блоки по blockSize штук. Блок хранит первое значение и разности соседних значений,
+       закодированные одним из двух способов (выбирается более короткий):
+         - varint: 7 бит разности на байт, старший бит - признак продолжения (выгоден при неравномерных разностях);
+         - frame of reference: все разности упакованы одинаковой шириной, равной ширине наибольшей разности.
+       Для каждого блока также запоминаются первое и последнее значения, поэтому поиск (operator<<)
+       находит единственный подходящий блок двоичным поиском и распаковывает только его.
+       Последний неполный блок хранится несжатым и кодируется, когда заполнится. */
+    class DeltaVector
+    {
+    public:
+        /* === Размер блока (количество значений): === */
+        static constexpr size_t blockSize = 128;
+
+
+    private:
+        /* === Способ кодирования разностей блока: === */
+        enum class Encoding : uint8_t { Varint, FrameOfReference };
+
+        /* === Описание блока: === */
+        struct Block
+        {
+            uint64_t first  = 0;                        // Первое значение блока.
+            uint64_t last   = 0;                        // Последнее (наибольшее) значение блока.
+            size_t   offset = 0;                        // Начало закодированных разностей в потоке байт.
+            Encoding encoding = Encoding::Varint;       // Способ кодирования разностей.
+            uint8_t  width    = 0;                      // Ширина разности в битах (для frame of reference).
+        };
+
+
+        /* === Данные вектора: === */
+        Vector<Block>    blocks;                        // Заголовки закодированных блоков.
+        Vector<uint8_t>  stream;                        // Закодированные разности всех блоков подряд.
+        Vector<uint64_t> tail;                          // Последний неполный блок (без сжатия).
+
+
+        /* === Вспомогательные методы: === */
+        void   sealTail();                              // Кодирование заполненного хвоста в новый блок.
+        size_t blockFor(uint64_t value) const;          // Первый блок, последнее значение которого не меньше value.
+
+
+    public:
+        /* === Описание структуры итератора (только чтение, распаковывает по блоку): === */
+        class Iterator;
+
+
+        /* === Методы для получения итераторов на начало и конец вектора: === */
+        Iterator begin() const;
+        Iterator end()   const;
+
+
+        /* === Конструкторы: === */
+        DeltaVector();                                              // Конструктор по умолчанию.
+        DeltaVector(const std::initializer_list<uint64_t>& values); // Конструктор из списка инициализации.
+
+
+        /* === Перегруженные операторы: === */
+        bool operator<<(uint64_t value) const;          // Оператор проверки наличия элемента (распаковывает не более одного блока).
+
+
+        /* === Методы для добавления и удаления элементов: === */
+        void pushBack(uint64_t value);                  // Добавление значения в конец (не меньше последнего).
+        void clear();                                   // Удаление всех значений.
+
+
+        /* === Методы доступа к элементам вектора: === */
+        uint64_t at(size_t index) const;                // Получение значения с проверкой границ (распаковывает блок).
+        uint64_t front() const;                         // Получение первого значения.
+        uint64_t back()  const;                         // Получение последнего значения.
+
+        size_t blockCount() const;                      // Количество блоков (включая неполный).
+        size_t decodeBlock(size_t block, uint64_t* out) const; // Распаковка блока в массив из blockSize значений, возвращает длину блока.
+        Vector<uint64_t> toVector() const;              // Распакованная копия всех значений.
+
+
+        /* === Методы для получения информации о векторе: === */
+        bool   isEmpty() const;                         // Проверка на пустоту вектора.
+        size_t size()    const;                         // Получение текущего размера вектора.
+        size_t bytes()   const;                         // Объём памяти под сжатые данные (в байтах).
+    };
+
+} // namespace Containers.
+
+
+
+/* ... ОПРЕДЕЛЕНИЕ ФУНКЦИОНАЛЬНОСТИ КЛАССА ... */
+namespace Containers
+{
+
+    /* === Описание структуры итератора: === */
+    class DeltaVector::Iterator
+    {
+    private:
+        // Вектор, текущий блок в распакованном виде и позиция в нём.
+        const DeltaVector* vector;
+        size_t currBlock;
+        size_t position;
+        size_t length;
+        std::array<uint64_t, blockSize> values;
+
+        void load()
+        {
+            position = 0;
+            length = (currBlock < vector->blockCount()) ? vector->decodeBlock(currBlock, values.data()) : 0;
+        }
+
+    public:
+        // Информация об итераторе для совместимости со стандартными алгоритмами:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = uint64_t;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const uint64_t*;
+        using reference         = const uint64_t&;
+
+        // Пользовательский конструктор:
+        Iterator(const DeltaVector* inputVector, size_t block) : vector(inputVector), currBlock(block), position(0), length(0), values() {
+            load();
+        }
+
+        // Оператор разыменования:
+        reference operator*() const { return values[position]; }
+
+        // Операторы инкрементирования (блок распаковывается целиком при переходе на него):
+        Iterator& operator++()
+        {
+            if (++position == length)
+            {
+                ++currBlock;
+                load();
+            }
+
+            return *this;
+        }
+
+        Iterator operator++(int) { Iterator temp = *this; ++(*this); return temp; }
+
+        // Операторы сравнения:
+        bool operator==(const Iterator& other) const { return currBlock == other.currBlock && position == other.position; }
+        bool operator!=(const Iterator& other) const { return !(*this == other); }
+    };
+
+
+    /* === Вспомогательные защищенные методы: === */
+    inline void DeltaVector::sealTail()
+    {
+        const uint64_t* values = &*tail.begin();
+
+        // Разности соседних значений, их наибольшая ширина и длина в формате varint.
+        uint64_t deltas[blockSize];
+        unsigned width = 0;
+        size_t varintBytes = 0;
+
+        for (size_t i = 1; i < blockSize; ++i)
+        {
+            deltas[i - 1] = values[i] - values[i - 1];
+
+            const unsigned bits = Packing::bitWidth(deltas[i - 1]);
+            width = std::max(width, bits);
+            varintBytes += (bits == 0) ? 1 : (bits + 6) / 7;
+        }
+
+        const size_t packedWords = Packing::wordsFor(blockSize - 1, width);
+
+        Block block;
+        block.first  = values[0];
+        block.last   = values[blockSize - 1];
+        block.offset = stream.size();
+        block.width  = static_cast<uint8_t>(width);
+
+        if (packedWords * sizeof(uint64_t) < varintBytes)
+        {
+            block.encoding = Encoding::FrameOfReference;
+
+            uint64_t packed[blockSize] = {};
+            for (size_t i = 0; i < blockSize - 1; ++i) {
+                Packing::write(packed, i, width, deltas[i]);
+            }
+
+            const uint8_t* raw = reinterpret_cast<const uint8_t*>(packed);
+            stream.append(raw, raw + packedWords * sizeof(uint64_t));
+        }
+        else
+        {
+            block.encoding = Encoding::Varint;
+
+            for (size_t i = 0; i < blockSize - 1; ++i)
+            {
+                uint64_t delta = deltas[i];
+
+                while (delta >= 0x80)
+                {
+                    stream.pushBack(static_cast<uint8_t>(delta | 0x80));
+                    delta >>= 7;
+                }
+
+                stream.pushBack(static_cast<uint8_t>(delta));
+            }
+        }
+
+        blocks.pushBack(block);
+        tail.clear();
+    }
+
+    inline size_t DeltaVector::blockFor(uint64_t value) const
+    {
+        // Блоки упорядочены по значениям - двоичный поиск по последним значениям блоков.
+        const Block* data = &*blocks.begin();
+        size_t low = 0, high = blocks.size();
+
+        while (low < high)
+        {
+            const size_t middle = low + (high - low) / 2;
+
+            if (data[middle].last < value) { low = middle + 1; }
+            else                           { high = middle; }
+        }
+
+        return low;
+    }
+
+
+    /* === Публичные методы для получения итераторов на начало и конец вектора: === */
+    inline DeltaVector::Iterator DeltaVector::begin() const { return Iterator(this, 0); }
+    inline DeltaVector::Iterator DeltaVector::end()   const { return Iterator(this, blockCount()); }
+
+
+    /* === Конструкторы: === */
+    inline DeltaVector::DeltaVector() : blocks(), stream(), tail(static_cast<int>(blockSize)) {}
+
+    inline DeltaVector::DeltaVector(const std::initializer_list<uint64_t>& values) : DeltaVector()
+    {
+        for (uint64_t value : values) {
+            pushBack(value);
+        }
+    }
+
+
+    /* === Перегруженные операторы: === */
+    inline bool DeltaVector::operator<<(uint64_t value) const
+    {
+        const size_t block = blockFor(value);
+
+        // Все закодированные блоки меньше value - остаётся проверить несжатый хвост.
+        if (block == blocks.size())
+        {
+            const uint64_t* values = &*tail.begin();
+            return std::binary_search(values, values + tail.size(), value);
+        }
+
+        // Значение меньше начала подходящего блока - его нет ни в этом блоке, ни в других.
+        if (blocks.begin()[block].first > value) { return false; }
+
+        uint64_t values[blockSize];
+        decodeBlock(block, values);
+
+        return std::binary_search(values, values + blockSize, value);
+    }
+
+
+    /* === Публичные методы для добавления и удаления элементов: === */
+    inline void DeltaVector::pushBack(uint64_t value)
+    {
+        if (!isEmpty() && value < back()) {
+            throw std::runtime_error("Error! DeltaVector values must be added in non-decreasing order.");
+        }
+
+        tail.pushBack(value);
+
+        if (tail.size() == blockSize) { sealTail(); }
+    }
+
+    inline void DeltaVector::clear()
+    {
+        blocks.clear();
+        stream.clear();
+        tail.clear();
+    }
+
+
+    /* === Публичные методы доступа к элементам вектора: === */
+    inline uint64_t DeltaVector::at(size_t index) const
+    {
+        if (index >= size()) {
+            throw std::out_of_range("Error! Index is out of range.");
+        }
+
+        uint64_t values[blockSize];
+        decodeBlock(index / blockSize, values);
+
+        return values[index % blockSize];
+    }
+
+    inline uint64_t DeltaVector::front() const
+    {
+        if (this->isEmpty()) {
+            throw std::runtime_error("Error! You cannot access the first element in an empty vector.");
+        }
+
+        return blocks.isEmpty() ? tail.front() : blocks.front().first;
+    }
+
+    inline uint64_t DeltaVector::back() const
+    {
+        if (this->isEmpty()) {
+            throw std::runtime_error("Error! You cannot access the last element in an empty vector.");
+        }
+
+        return tail.isEmpty() ? blocks.back().last : tail.back();
+    }
+
+    inline size_t DeltaVector::blockCount() const { return blocks.size() + (tail.isEmpty() ? 0 : 1); }
+
+    inline size_t DeltaVector::decodeBlock(size_t block, uint64_t* out) const
+    {
+        if (block >= blockCount()) {
+            throw std::out_of_range("Error! Index is out of range.");
+        }
+
+        if (block == blocks.size())
+        {
+            std::copy(tail.begin(), tail.end(), out);
+            return tail.size();
+        }
+
+        const Block&   header = blocks.begin()[block];
+        const uint8_t* data   = &*stream.begin() + header.offset;
+
+        out[0] = header.first;
+
+        if (header.encoding == Encoding::FrameOfReference)
+        {
+            // Упакованные слова копирую в выровненный буфер, распаковываю разности на их места в out.
+            const size_t packedWords = Packing::wordsFor(blockSize - 1, header.width);
+            uint64_t packed[blockSize];
+
+            std::memcpy(packed, data, packedWords * sizeof(uint64_t));
+            Packing::unpack(packed, 0, blockSize - 1, header.width, out + 1);
+        }
+        else
+        {
+            for (size_t i = 1; i < blockSize; ++i)
+            {
+                uint64_t delta = 0;
+                unsigned shift = 0;
+
+                while (*data & 0x80)
+                {
+                    delta |= uint64_t(*data++ & 0x7F) << shift;
+                    shift += 7;
+                }
+
+                out[i] = delta | (uint64_t(*data++) << shift);
+            }
+        }
+
+        // Префиксная сумма разностей восстанавливает значения.
+        for (size_t i = 1; i < blockSize; ++i) {
+            out[i] += out[i - 1];
+        }
+
+        return blockSize;
+    }
+
+    inline Vector<uint64_t> DeltaVector::toVector() const
+    {
+        Vector<uint64_t> result;
+        result.resize(size());
+
+        for (size_t block = 0; block < blockCount(); ++block) {
+            decodeBlock(block, &result[0] + block * blockSize);
+        }
+
+        return result;
+    }
+
+
+    /* === Публичные методы для получения информации о векторе: === */
+    inline bool   DeltaVector::isEmpty() const { return size() == 0; }
+    inline size_t DeltaVector::size()    const { return blocks.size() * blockSize + tail.size(); }
+
+    inline size_t DeltaVector::bytes() const {
+        return blocks.size() * sizeof(Block) + stream.size() + tail.size() * sizeof(uint64_t);
+    }
+
+} // namespace Containers.
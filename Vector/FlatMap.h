@@ -0,0 +1,368 @@
+#pragma once
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include "FlatSet.h"
+
+// Пространство имен Containers предназначено для хранения различных контейнеров.
+namespace Containers
+{
+    /* FlatMap - ассоциативный массив на отсортированных векторах.
+       Ключи и значения хранятся в двух отдельных векторах: бинарный поиск проходит только по плотному
+       массиву ключей (в строку кэша их помещается больше), а значение читается один раз по найденному индексу.
+       Ключи уникальны; поиск - O(log n), одиночная вставка и удаление - O(n), пакетная вставка - слиянием. */
+    template<typename K, typename V, typename Compare = std::less<K>>
+    class FlatMap
+    {
+    private:
+        /* === Данные ассоциативного массива: === */
+        Vector<K> keys;                                 // Отсортированные уникальные ключи.
+        Vector<V> values;                               // Значения (values[i] соответствует keys[i]).
+        Compare   comparator;                           // Функция сравнения ключей.
+
+
+        /* === Вспомогательные методы: === */
+        size_t indexOf(const K& key) const;             // Индекс ключа (size(), если не найден).
+        size_t lowerIndex(const K& key) const;          // Индекс первого ключа, не меньшего key.
+
+        template<typename Pairs>
+        void assignSorted(const Pairs& sorted);         // Заполнение из отсортированных по ключу пар (повторы отбрасываются).
+
+
+    public:
+        /* === Итератор (разыменование даёт пару ссылок: ключ и значение): === */
+        class Iterator;
+
+
+        /* === Методы для получения итераторов на начало и конец массива: === */
+        Iterator begin() const;
+        Iterator end()   const;
+
+
+        /* === Конструкторы: === */
+        FlatMap();                                                          // Конструктор по умолчанию.
+        FlatMap(const std::initializer_list<std::pair<K, V>>& pairs);      // Конструктор из списка пар.
+        explicit FlatMap(const BinarySearchTree<std::pair<K, V>>& tree);   // Конструктор из дерева пар (сортирует, только если порядок дерева не совпадает с Compare).
+
+
+        /* === Методы для добавления и удаления элементов: === */
+        bool insert(const K& key, const V& value);                  // Добавление пары (false - ключ уже был, значение не меняется).
+        void insertOrAssign(const K& key, const V& value);          // Добавление пары или замена значения.
+
+        template<typename InputIt>
+        void insertRange(InputIt first, InputIt last);              // Добавление пакета пар слиянием за один проход.
+
+        bool erase(const K& key);                                   // Удаление пары по ключу (false - не найден).
+        void clear();                                               // Удаление всех пар.
+        void reserve(size_t newCapacity);                           // Увеличение ёмкости до заданной.
+
+
+        /* === Методы доступа к значениям: === */
+        V& operator[](const K& key);                                // Значение по ключу (создаётся по умолчанию, если ключа нет).
+        V& at(const K& key);                                        // Значение по ключу (исключение, если ключа нет).
+
+
+        /* === Методы для поиска элементов: === */
+        bool     contains(const K& key) const;                      // Проверка наличия ключа.
+        V*       find(const K& key) const;                          // Указатель на значение (nullptr, если ключ не найден).
+        Iterator lowerBound(const K& key) const;                    // Первая пара с ключом, не меньшим key.
+
+
+        /* === Методы для получения информации о массиве: === */
+        bool   isEmpty() const;                                     // Проверка на пустоту массива.
+        size_t size()    const;                                     // Количество пар.
+
+        const Vector<K>& keyVector()   const;                       // Отсортированные ключи.
+        const Vector<V>& valueVector() const;                       // Значения в порядке ключей.
+    };
+
+} // namespace Containers.
+
+
+
+/* ... ОПРЕДЕЛЕНИЕ ФУНКЦИОНАЛЬНОСТИ КЛАССА ... */
+namespace Containers
+{
+
+    /* === Описание структуры итератора: === */
+    template<typename K, typename V, typename Compare>
+    class FlatMap<K, V, Compare>::Iterator
+    {
+    private:
+        // Массив и индекс текущей пары (ключи и значения лежат в разных векторах).
+        const FlatMap* map;
+        size_t currIndex;
+
+    public:
+        // Информация об итераторе для совместимости со стандартными алгоритмами:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = std::pair<const K&, V&>;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = void;
+        using reference         = std::pair<const K&, V&>;
+
+        // Пользовательский конструктор:
+        Iterator(const FlatMap* inputMap, size_t index) : map(inputMap), currIndex(index) {}
+
+        // Оператор разыменования:
+        reference operator*() const {
+            return reference(*(map->keys.begin() + currIndex), *(map->values.begin() + currIndex));
+        }
+
+        // Операторы инкрементирования и декрементирования:
+        Iterator& operator++()    { ++currIndex; return *this; }
+        Iterator  operator++(int) { Iterator temp = *this; ++currIndex; return temp; }
+        Iterator& operator--()    { --currIndex; return *this; }
+        Iterator  operator--(int) { Iterator temp = *this; --currIndex; return temp; }
+
+        // Арифметические операторы:
+        Iterator  operator+(difference_type n) const { return Iterator(map, currIndex + n); }
+        Iterator  operator-(difference_type n) const { return Iterator(map, currIndex - n); }
+
+        Iterator& operator+=(difference_type n) { currIndex += n; return *this; }
+        Iterator& operator-=(difference_type n) { currIndex -= n; return *this; }
+
+        difference_type operator-(const Iterator& other) const {
+            return static_cast<difference_type>(currIndex) - static_cast<difference_type>(other.currIndex);
+        }
+
+        // Операторы сравнения:
+        bool operator==(const Iterator& other) const { return currIndex == other.currIndex; }
+        bool operator!=(const Iterator& other) const { return currIndex != other.currIndex; }
+        bool operator<=(const Iterator& other) const { return currIndex <= other.currIndex; }
+        bool operator>=(const Iterator& other) const { return currIndex >= other.currIndex; }
+        bool operator< (const Iterator& other) const { return currIndex < other.currIndex;  }
+        bool operator> (const Iterator& other) const { return currIndex > other.currIndex;  }
+
+        // Индекс текущей пары:
+        size_t index() const { return currIndex; }
+    };
+
+
+    /* === Вспомогательные защищенные методы: === */
+    template<typename K, typename V, typename Compare>
+    size_t FlatMap<K, V, Compare>::lowerIndex(const K& key) const {
+        return Flat::lowerBound(&*keys.begin(), keys.size(), key, comparator);
+    }
+
+    template<typename K, typename V, typename Compare>
+    size_t FlatMap<K, V, Compare>::indexOf(const K& key) const
+    {
+        const size_t index = lowerIndex(key);
+        const K* data = &*keys.begin();
+
+        return (index != keys.size() && !comparator(key, data[index])) ? index : keys.size();
+    }
+
+    template<typename K, typename V, typename Compare>
+    template<typename Pairs>
+    void FlatMap<K, V, Compare>::assignSorted(const Pairs& sorted)
+    {
+        keys.clear();
+        values.clear();
+        keys.reserve(sorted.size());
+        values.reserve(sorted.size());
+
+        // Из нескольких пар с одинаковым ключом остаётся первая.
+        for (const auto& pair : sorted)
+        {
+            if (!keys.isEmpty() && !comparator(keys[keys.size() - 1], pair.first)) { continue; }
+
+            keys.pushBack(pair.first);
+            values.pushBack(pair.second);
+        }
+    }
+
+
+    /* === Публичные методы для получения итераторов на начало и конец массива: === */
+    template<typename K, typename V, typename Compare>
+    typename FlatMap<K, V, Compare>::Iterator FlatMap<K, V, Compare>::begin() const { return Iterator(this, 0); }
+
+    template<typename K, typename V, typename Compare>
+    typename FlatMap<K, V, Compare>::Iterator FlatMap<K, V, Compare>::end() const { return Iterator(this, keys.size()); }
+
+
+    /* === Конструкторы: === */
+    template<typename K, typename V, typename Compare>
+    FlatMap<K, V, Compare>::FlatMap() : keys(), values(), comparator() {}
+
+    template<typename K, typename V, typename Compare>
+    FlatMap<K, V, Compare>::FlatMap(const std::initializer_list<std::pair<K, V>>& pairs) : FlatMap() {
+        this->insertRange(pairs.begin(), pairs.end());
+    }
+
+    template<typename K, typename V, typename Compare>
+    FlatMap<K, V, Compare>::FlatMap(const BinarySearchTree<std::pair<K, V>>& tree) : FlatMap()
+    {
+        /* toVector() обходит дерево по порядку operator< для пар, то есть по ключу в смысле std::less.
+           Если Compare задаёт другой порядок, пары пересортировываются устойчиво: из повторов ключа остаётся первая. */
+        std::vector<std::pair<K, V>> pairs = tree.toVector();
+
+        const auto byKey = [this](const std::pair<K, V>& left, const std::pair<K, V>& right) { return comparator(left.first, right.first); };
+        if (!std::is_sorted(pairs.begin(), pairs.end(), byKey)) {
+            std::stable_sort(pairs.begin(), pairs.end(), byKey);
+        }
+
+        assignSorted(pairs);
+    }
+
+
+    /* === Публичные методы для добавления и удаления элементов: === */
+    template<typename K, typename V, typename Compare>
+    bool FlatMap<K, V, Compare>::insert(const K& key, const V& value)
+    {
+        const size_t index = lowerIndex(key);
+        if (index != keys.size() && !comparator(key, keys[index])) { return false; }
+
+        values.insert(values.begin() + index, value);
+        try { keys.insert(keys.begin() + index, key); }
+        catch (...)
+        {
+            // Векторы должны оставаться одинаковой длины.
+            values.erase(values.begin() + index);
+            throw;
+        }
+
+        return true;
+    }
+
+    template<typename K, typename V, typename Compare>
+    void FlatMap<K, V, Compare>::insertOrAssign(const K& key, const V& value)
+    {
+        const size_t index = indexOf(key);
+
+        if (index != keys.size()) { values[index] = value; }
+        else                      { this->insert(key, value); }
+    }
+
+    template<typename K, typename V, typename Compare>
+    template<typename InputIt>
+    void FlatMap<K, V, Compare>::insertRange(InputIt first, InputIt last)
+    {
+        // 1. Собираю пакет и устойчиво сортирую его по ключу (при повторах побеждает первая пара пакета).
+        Vector<std::pair<K, V>> batch;
+        batch.append(first, last);
+        if (batch.isEmpty()) { return; }
+
+        auto byKey = [this](const std::pair<K, V>& left, const std::pair<K, V>& right) { return comparator(left.first, right.first); };
+        if (!std::is_sorted(batch.begin(), batch.end(), byKey)) {
+            std::stable_sort(batch.begin(), batch.end(), byKey);
+        }
+
+        // 2. Сливаю текущие пары и пакет за один проход; при совпадении ключа остаётся текущее значение.
+        Vector<K> mergedKeys;
+        Vector<V> mergedValues;
+        mergedKeys.reserve(keys.size() + batch.size());
+        mergedValues.reserve(keys.size() + batch.size());
+
+        size_t left = 0, right = 0;
+        while (left < keys.size() || right < batch.size())
+        {
+            const bool takeBatch = left == keys.size()
+                                || (right < batch.size() && comparator(batch[right].first, keys[left]));
+
+            if (takeBatch)
+            {
+                // Повтор ключа внутри пакета или совпадение с уже добавленным ключом - пропускаю.
+                if (mergedKeys.isEmpty() || comparator(mergedKeys[mergedKeys.size() - 1], batch[right].first))
+                {
+                    mergedKeys.pushBack(std::move(batch[right].first));
+                    mergedValues.pushBack(std::move(batch[right].second));
+                }
+                ++right;
+            }
+            else
+            {
+                mergedKeys.pushBack(std::move(keys[left]));
+                mergedValues.pushBack(std::move(values[left]));
+                ++left;
+
+                // Пары пакета с тем же ключом отбрасываются.
+                while (right < batch.size() && !comparator(mergedKeys[mergedKeys.size() - 1], batch[right].first)) { ++right; }
+            }
+        }
+
+        keys = std::move(mergedKeys);
+        values = std::move(mergedValues);
+    }
+
+    template<typename K, typename V, typename Compare>
+    bool FlatMap<K, V, Compare>::erase(const K& key)
+    {
+        const size_t index = indexOf(key);
+        if (index == keys.size()) { return false; }
+
+        keys.erase(keys.begin() + index);
+        values.erase(values.begin() + index);
+        return true;
+    }
+
+    template<typename K, typename V, typename Compare>
+    void FlatMap<K, V, Compare>::clear()
+    {
+        keys.clear();
+        values.clear();
+    }
+
+    template<typename K, typename V, typename Compare>
+    void FlatMap<K, V, Compare>::reserve(size_t newCapacity)
+    {
+        keys.reserve(newCapacity);
+        values.reserve(newCapacity);
+    }
+
+
+    /* === Публичные методы доступа к значениям: === */
+    template<typename K, typename V, typename Compare>
+    V& FlatMap<K, V, Compare>::operator[](const K& key)
+    {
+        const size_t index = lowerIndex(key);
+
+        if (index == keys.size() || comparator(key, keys[index])) {
+            this->insert(key, V());
+        }
+
+        return values[index];
+    }
+
+    template<typename K, typename V, typename Compare>
+    V& FlatMap<K, V, Compare>::at(const K& key)
+    {
+        const size_t index = indexOf(key);
+
+        if (index == keys.size()) {
+            throw std::out_of_range("Error! Key is not found.");
+        }
+
+        return values[index];
+    }
+
+
+    /* === Публичные методы для поиска элементов: === */
+    template<typename K, typename V, typename Compare>
+    bool FlatMap<K, V, Compare>::contains(const K& key) const { return indexOf(key) != keys.size(); }
+
+    template<typename K, typename V, typename Compare>
+    V* FlatMap<K, V, Compare>::find(const K& key) const
+    {
+        const size_t index = indexOf(key);
+        return (index == keys.size()) ? nullptr : &*(values.begin() + index);
+    }
+
+    template<typename K, typename V, typename Compare>
+    typename FlatMap<K, V, Compare>::Iterator FlatMap<K, V, Compare>::lowerBound(const K& key) const {
+        return Iterator(this, lowerIndex(key));
+    }
+
+
+    /* === Публичные методы для получения информации о массиве: === */
+    template<typename K, typename V, typename Compare> bool   FlatMap<K, V, Compare>::isEmpty() const { return keys.isEmpty(); }
+    template<typename K, typename V, typename Compare> size_t FlatMap<K, V, Compare>::size()    const { return keys.size();    }
+
+    template<typename K, typename V, typename Compare>
+    const Vector<K>& FlatMap<K, V, Compare>::keyVector() const { return keys; }
+
+    template<typename K, typename V, typename Compare>
+    const Vector<V>& FlatMap<K, V, Compare>::valueVector() const { return values; }
+
+} // namespace Containers.
\ No newline at end of file
@@ -0,0 +1,267 @@
+#pragma once
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include "Vector.h"
+#include "../BinarySearchTree/BinarySearchTree.h"
+
+// Пространство имен Containers предназначено для хранения различных контейнеров.
+namespace Containers
+{
+    // Пространство имен Flat содержит вспомогательные функции "плоских" (на отсортированном векторе) контейнеров.
+    namespace Flat
+    {
+        /* Бинарный поиск первого элемента, не меньшего value (аналог std::lower_bound).
+           Цикл без ветвлений: на каждом шаге сдвигается только начало диапазона (компилятор использует cmov),
+           поэтому нет ошибок предсказания переходов, которые и составляют основную цену поиска. */
+        template<typename T, typename U, typename Compare>
+        size_t lowerBound(const T* data, size_t count, const U& value, const Compare& comparator)
+        {
+            if (count == 0) { return 0; }
+
+            const T* base = data;
+            while (count > 1)
+            {
+                const size_t half = count / 2;
+                base = comparator(base[half], value) ? base + half : base;
+                count -= half;
+            }
+
+            return static_cast<size_t>(base - data) + (comparator(*base, value) ? 1 : 0);
+        }
+
+        // Удаление соседних дубликатов в отсортированном векторе (остаётся первый из равных).
+        template<typename T, typename Compare>
+        void removeDuplicates(Vector<T>& values, const Compare& comparator)
+        {
+            if (values.size() < 2) { return; }
+
+            auto last = std::unique(values.begin(), values.end(),
+                [&comparator](const T& left, const T& right) { return !comparator(left, right) && !comparator(right, left); });
+
+            values.erase(last, values.end());
+        }
+    }
+
+
+    /* FlatSet - множество уникальных элементов на отсортированном векторе.
+       В отличие от BinarySearchTree, элементы лежат подряд в одном блоке памяти: поиск - бинарный,
+       без переходов по указателям между узлами, и нет накладных расходов на два указателя в каждом узле.
+       Поиск - O(log n), вставка и удаление одиночного элемента - O(n) (сдвиг хвоста), поэтому
+       контейнер рассчитан на данные "чаще читаем, чем пишем"; пакеты элементов лучше добавлять через insertRange. */
+    template<typename T, typename Compare = std::less<T>>
+    class FlatSet
+    {
+    private:
+        /* === Данные множества: === */
+        Vector<T> elements;                             // Отсортированные уникальные элементы.
+        Compare   comparator;                           // Функция сравнения элементов.
+
+
+        /* === Вспомогательные методы: === */
+        const T* data() const;                          // Указатель на первый элемент (для бинарного поиска).
+        bool     equal(const T& left, const T& right) const; // Эквивалентность элементов с точки зрения comparator.
+        void     normalize();                           // Сортировка и удаление дубликатов.
+
+
+    public:
+        /* === Итератор (тот же, что у Vector): === */
+        using Iterator = typename Vector<T>::Iterator;
+
+
+        /* === Методы для получения итераторов на начало и конец множества: === */
+        Iterator begin() const;
+        Iterator end()   const;
+
+
+        /* === Конструкторы: === */
+        FlatSet();                                                  // Конструктор по умолчанию.
+        FlatSet(const std::initializer_list<T>& values);            // Конструктор из списка инициализации.
+        explicit FlatSet(Vector<T> values);                         // Конструктор из произвольного вектора.
+        explicit FlatSet(const BinarySearchTree<T>& tree);          // Конструктор из дерева (сортирует, только если порядок дерева не совпадает с Compare).
+
+
+        /* === Методы для добавления и удаления элементов: === */
+        bool insert(const T& value);                                // Добавление элемента (false - уже был).
+
+        template<typename InputIt>
+        void insertRange(InputIt first, InputIt last);              // Добавление пакета элементов слиянием за один проход.
+
+        bool erase(const T& value);                                 // Удаление элемента (false - не найден).
+        void clear();                                               // Удаление всех элементов.
+        void reserve(size_t newCapacity);                           // Увеличение ёмкости до заданной.
+
+
+        /* === Методы для поиска элементов: === */
+        bool     contains(const T& value) const;                    // Проверка наличия элемента.
+        Iterator find(const T& value) const;                        // Итератор на элемент (end(), если не найден).
+        Iterator lowerBound(const T& value) const;                  // Первый элемент, не меньший value.
+        Iterator upperBound(const T& value) const;                  // Первый элемент, больший value.
+
+
+        /* === Методы для получения информации о множестве: === */
+        bool   isEmpty() const;                                     // Проверка на пустоту множества.
+        size_t size()    const;                                     // Количество элементов.
+
+        const Vector<T>& toVector() const;                          // Отсортированные элементы множества.
+    };
+
+} // namespace Containers.
+
+
+
+/* ... ОПРЕДЕЛЕНИЕ ФУНКЦИОНАЛЬНОСТИ КЛАССА ... */
+namespace Containers
+{
+
+    /* === Вспомогательные защищенные методы: === */
+    template<typename T, typename Compare>
+    const T* FlatSet<T, Compare>::data() const { return &*elements.begin(); }
+
+    template<typename T, typename Compare>
+    bool FlatSet<T, Compare>::equal(const T& left, const T& right) const {
+        return !comparator(left, right) && !comparator(right, left);
+    }
+
+    template<typename T, typename Compare>
+    void FlatSet<T, Compare>::normalize()
+    {
+        // Уже отсортированный вход (частый случай) не пересортировываю.
+        if (!std::is_sorted(elements.begin(), elements.end(), comparator)) {
+            std::sort(elements.begin(), elements.end(), comparator);
+        }
+
+        Flat::removeDuplicates(elements, comparator);
+    }
+
+
+    /* === Публичные методы для получения итераторов на начало и конец множества: === */
+    template<typename T, typename Compare> typename FlatSet<T, Compare>::Iterator FlatSet<T, Compare>::begin() const { return elements.begin(); }
+    template<typename T, typename Compare> typename FlatSet<T, Compare>::Iterator FlatSet<T, Compare>::end()   const { return elements.end();   }
+
+
+    /* === Конструкторы: === */
+    template<typename T, typename Compare>
+    FlatSet<T, Compare>::FlatSet() : elements(), comparator() {}
+
+    template<typename T, typename Compare>
+    FlatSet<T, Compare>::FlatSet(const std::initializer_list<T>& values) : elements(values), comparator() {
+        normalize();
+    }
+
+    template<typename T, typename Compare>
+    FlatSet<T, Compare>::FlatSet(Vector<T> values) : elements(std::move(values)), comparator() {
+        normalize();
+    }
+
+    template<typename T, typename Compare>
+    FlatSet<T, Compare>::FlatSet(const BinarySearchTree<T>& tree) : elements(), comparator()
+    {
+        /* toVector() обходит дерево по порядку operator<. При Compare = std::less элементы уже отсортированы,
+           и normalize() только проверит это за один проход; при другом Compare (например, std::greater) - пересортирует. */
+        const std::vector<T> ordered = tree.toVector();
+
+        elements.reserve(ordered.size());
+        elements.append(ordered.begin(), ordered.end());
+
+        normalize();
+    }
+
+
+    /* === Публичные методы для добавления и удаления элементов: === */
+    template<typename T, typename Compare>
+    bool FlatSet<T, Compare>::insert(const T& value)
+    {
+        const size_t index = Flat::lowerBound(data(), size(), value, comparator);
+        if (index != size() && equal(elements[index], value)) { return false; }
+
+        elements.insert(begin() + index, value);
+        return true;
+    }
+
+    template<typename T, typename Compare>
+    template<typename InputIt>
+    void FlatSet<T, Compare>::insertRange(InputIt first, InputIt last)
+    {
+        // 1. Собираю пакет, сортирую его (если он не отсортирован) и убираю повторы внутри пакета.
+        Vector<T> batch;
+        batch.append(first, last);
+        if (batch.isEmpty()) { return; }
+
+        if (!std::is_sorted(batch.begin(), batch.end(), comparator)) {
+            std::sort(batch.begin(), batch.end(), comparator);
+        }
+        Flat::removeDuplicates(batch, comparator);
+
+        // 2. Сливаю текущие элементы и пакет за один проход (вместо n вставок со сдвигом хвоста).
+        Vector<T> merged;
+        merged.reserve(size() + batch.size());
+
+        size_t left = 0, right = 0;
+        while (left < size() && right < batch.size())
+        {
+            if (comparator(elements[left], batch[right]))      { merged.pushBack(std::move(elements[left++])); }
+            else if (comparator(batch[right], elements[left])) { merged.pushBack(std::move(batch[right++])); }
+            else { merged.pushBack(std::move(elements[left++])); ++right; }   // Элемент уже есть в множестве.
+        }
+
+        for (; left < size(); ++left)          { merged.pushBack(std::move(elements[left])); }
+        for (; right < batch.size(); ++right)  { merged.pushBack(std::move(batch[right])); }
+
+        elements = std::move(merged);
+    }
+
+    template<typename T, typename Compare>
+    bool FlatSet<T, Compare>::erase(const T& value)
+    {
+        const size_t index = Flat::lowerBound(data(), size(), value, comparator);
+        if (index == size() || !equal(elements[index], value)) { return false; }
+
+        elements.erase(begin() + index);
+        return true;
+    }
+
+    template<typename T, typename Compare>
+    void FlatSet<T, Compare>::clear() { elements.clear(); }
+
+    template<typename T, typename Compare>
+    void FlatSet<T, Compare>::reserve(size_t newCapacity) { elements.reserve(newCapacity); }
+
+
+    /* === Публичные методы для поиска элементов: === */
+    template<typename T, typename Compare>
+    bool FlatSet<T, Compare>::contains(const T& value) const
+    {
+        const size_t index = Flat::lowerBound(data(), size(), value, comparator);
+        return index != size() && equal(data()[index], value);
+    }
+
+    template<typename T, typename Compare>
+    typename FlatSet<T, Compare>::Iterator FlatSet<T, Compare>::find(const T& value) const
+    {
+        const size_t index = Flat::lowerBound(data(), size(), value, comparator);
+        return (index != size() && equal(data()[index], value)) ? begin() + index : end();
+    }
+
+    template<typename T, typename Compare>
+    typename FlatSet<T, Compare>::Iterator FlatSet<T, Compare>::lowerBound(const T& value) const {
+        return begin() + Flat::lowerBound(data(), size(), value, comparator);
+    }
+
+    template<typename T, typename Compare>
+    typename FlatSet<T, Compare>::Iterator FlatSet<T, Compare>::upperBound(const T& value) const
+    {
+        // Первый элемент, больший value, - это первый элемент, для которого не выполняется !(value < element).
+        return begin() + Flat::lowerBound(data(), size(), value,
+            [this](const T& element, const T& key) { return !comparator(key, element); });
+    }
+
+
+    /* === Публичные методы для получения информации о множестве: === */
+    template<typename T, typename Compare> bool   FlatSet<T, Compare>::isEmpty() const { return elements.isEmpty(); }
+    template<typename T, typename Compare> size_t FlatSet<T, Compare>::size()    const { return elements.size();    }
+
+    template<typename T, typename Compare>
+    const Vector<T>& FlatSet<T, Compare>::toVector() const { return elements; }
+
+} // namespace Containers.
\ No newline at end of file
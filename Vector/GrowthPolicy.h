@@ -0,0 +1,169 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+
+/* CONTAINERS_VECTOR_STATS - учёт перевыделений векторов (VectorStats в каждом векторе и глобальные счётчики VectorTelemetry).
+   По умолчанию выключен: статистика увеличивает каждый вектор на 32 байта и добавляет атомарные операции
+   над общими счётчиками в каждое перевыделение. Для диагностики включается до подключения заголовков:
+   #define CONTAINERS_VECTOR_STATS 1 (или ключом компилятора -DCONTAINERS_VECTOR_STATS=1). */
+#ifndef CONTAINERS_VECTOR_STATS
+    #define CONTAINERS_VECTOR_STATS 0
+#endif
+
+// Пространство имен Containers предназначено для хранения различных контейнеров.
+namespace Containers
+{
+    /* GrowthPolicy - стратегия роста ёмкости вектора при нехватке места.
+       Удвоение даёт наименьшее число перевыделений, но в пике может держать почти вдвое больше памяти,
+       чем нужно; рост в 1.5 раза и постоянными порциями экономнее по памяти ценой более частых переносов,
+       а округление до страниц не оставляет недоиспользованных "хвостов" страниц у больших буферов. */
+    struct GrowthPolicy
+    {
+        /* === Вид стратегии: === */
+        enum class Kind : unsigned char
+        {
+            Double,         // Рост вдвое.
+            OneAndHalf,     // Рост в 1.5 раза.
+            Chunk,          // Рост на постоянное количество элементов (parameter).
+            PageRounded     // Рост в 1.5 раза с округлением размера буфера вверх до страницы (parameter - размер страницы в байтах).
+        };
+
+
+        /* === Параметры стратегии: === */
+        Kind   kind            = Kind::Double;  // Вид стратегии.
+        size_t parameter       = 0;             // Размер порции или страницы (для Chunk и PageRounded).
+        size_t initialCapacity = 10;            // Начальная ёмкость вектора, созданного с этой стратегией.
+
+
+        /* === Готовые стратегии: === */
+        static GrowthPolicy doubling(size_t initial = 10)   { return { Kind::Double, 0, initial }; }
+        static GrowthPolicy oneAndHalf(size_t initial = 10) { return { Kind::OneAndHalf, 0, initial }; }
+        static GrowthPolicy chunk(size_t elements, size_t initial = 10) { return { Kind::Chunk, elements == 0 ? 1 : elements, initial }; }
+        static GrowthPolicy pageRounded(size_t pageBytes = 4096, size_t initial = 10) { return { Kind::PageRounded, pageBytes == 0 ? 1 : pageBytes, initial }; }
+
+
+        /* === Вычисление новой ёмкости (не меньше required и больше current): === */
+        size_t nextCapacity(size_t current, size_t required, size_t elementSize) const
+        {
+            size_t grown = 0;
+
+            switch (kind)
+            {
+            case Kind::Double:      grown = current * 2;              break;
+            case Kind::OneAndHalf:  grown = current + current / 2;    break;
+            case Kind::Chunk:       grown = current + parameter;      break;
+            case Kind::PageRounded: grown = current + current / 2;    break;
+            }
+
+            if (grown <= current) { grown = current + 1; }
+            if (grown < required) { grown = required; }
+
+            // Округляю размер буфера в байтах вверх до целого числа страниц.
+            if (kind == Kind::PageRounded && elementSize != 0)
+            {
+                const size_t bytes = (grown * elementSize + parameter - 1) / parameter * parameter;
+                grown = bytes / elementSize;
+            }
+
+            return grown;
+        }
+    };
+
+
+    /* GrowthRule - то, что вектор хранит из стратегии роста: вид и параметр (16 байт вместо 24).
+       Начальная ёмкость нужна только при создании вектора, поэтому в правило не входит. */
+    struct GrowthRule
+    {
+        GrowthPolicy::Kind kind      = GrowthPolicy::Kind::Double;  // Вид стратегии.
+        size_t             parameter = 0;                           // Размер порции или страницы (для Chunk и PageRounded).
+
+        GrowthRule() = default;
+        GrowthRule(const GrowthPolicy& policy) : kind(policy.kind), parameter(policy.parameter) {}
+
+        // Стратегия с этим правилом (начальная ёмкость - по умолчанию).
+        GrowthPolicy policy() const
+        {
+            GrowthPolicy result;
+            result.kind      = kind;
+            result.parameter = parameter;
+            return result;
+        }
+
+        size_t nextCapacity(size_t current, size_t required, size_t elementSize) const {
+            return policy().nextCapacity(current, required, elementSize);
+        }
+    };
+
+
+    /* VectorStats - статистика перевыделений памяти вектора (по отдельному вектору или по всем сразу). */
+    struct VectorStats
+    {
+        size_t reallocations = 0;       // Количество перевыделений буфера.
+        size_t bytesMoved    = 0;       // Сколько байт элементов было скопировано или перемещено при перевыделениях.
+        size_t peakCapacity  = 0;       // Наибольшая ёмкость в элементах.
+        size_t peakBytes     = 0;       // Наибольший размер буфера в байтах.
+    };
+
+
+    /* VectorTelemetry - глобальные счётчики перевыделений всех векторов (любых типов элементов).
+       Счётчики обновляются только при перевыделении и только при включённом CONTAINERS_VECTOR_STATS,
+       иначе global() всегда возвращает нули. */
+    class VectorTelemetry
+    {
+    private:
+        /* === Глобальные счётчики: === */
+        static inline std::atomic<size_t> reallocations{ 0 };
+        static inline std::atomic<size_t> bytesMoved{ 0 };
+        static inline std::atomic<size_t> peakCapacity{ 0 };
+        static inline std::atomic<size_t> peakBytes{ 0 };
+
+        // Атомарное обновление максимума.
+        static void raise(std::atomic<size_t>& peak, size_t value)
+        {
+            size_t current = peak.load(std::memory_order_relaxed);
+            while (current < value && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+        }
+
+    public:
+        /* === Учёт перевыделения (вызывается вектором): === */
+        static void record(VectorStats& local, size_t newCapacity, size_t elementSize, size_t moved)
+        {
+            ++local.reallocations;
+            local.bytesMoved += moved;
+            observe(local, newCapacity, elementSize);
+
+            reallocations.fetch_add(1, std::memory_order_relaxed);
+            bytesMoved.fetch_add(moved, std::memory_order_relaxed);
+        }
+
+        /* === Учёт ёмкости без перевыделения (начальное выделение): === */
+        static void observe(VectorStats& local, size_t capacity, size_t elementSize)
+        {
+            if (capacity > local.peakCapacity)              { local.peakCapacity = capacity; }
+            if (capacity * elementSize > local.peakBytes)   { local.peakBytes = capacity * elementSize; }
+
+            raise(peakCapacity, capacity);
+            raise(peakBytes, capacity * elementSize);
+        }
+
+        /* === Получение и сброс глобальной статистики: === */
+        static VectorStats global()
+        {
+            VectorStats result;
+            result.reallocations = reallocations.load(std::memory_order_relaxed);
+            result.bytesMoved    = bytesMoved.load(std::memory_order_relaxed);
+            result.peakCapacity  = peakCapacity.load(std::memory_order_relaxed);
+            result.peakBytes     = peakBytes.load(std::memory_order_relaxed);
+            return result;
+        }
+
+        static void reset()
+        {
+            reallocations.store(0, std::memory_order_relaxed);
+            bytesMoved.store(0, std::memory_order_relaxed);
+            peakCapacity.store(0, std::memory_order_relaxed);
+            peakBytes.store(0, std::memory_order_relaxed);
+        }
+    };
+
+} // namespace Containers.
\ No newline at end of file
@@ -0,0 +1,628 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <typeinfo>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "Vector.h"
+
+// Пространство имен Containers предназначено для хранения различных контейнеров.
+namespace Containers
+{
+    /* MappedTypeTag - метка типа элементов, которая записывается в заголовок файла MappedVector.
+       По умолчанию вычисляется по имени типа и его размеру; для переносимости файлов между
+       компиляторами метку можно задать явно специализацией шаблона. */
+    template<typename T>
+    struct MappedTypeTag
+    {
+        static uint64_t value()
+        {
+            // Хеш FNV-1a от имени типа, смешанный с его размером.
+            uint64_t hash = 14695981039346656037ull;
+            for (const char* symbol = typeid(T).name(); *symbol != '\0'; ++symbol) {
+                hash = (hash ^ static_cast<unsigned char>(*symbol)) * 1099511628211ull;
+            }
+
+            return hash ^ sizeof(T);
+        }
+    };
+
+
+    /* MappedVector - вектор, элементы которого хранятся в файле, отображённом в память (mmap).
+       Файл начинается с небольшого заголовка (размер, ёмкость, метка типа), за ним лежат элементы.
+       Открытие существующего файла выполняется за O(1): данные подгружаются ядром лениво, по страницам,
+       поэтому даже многогигабайтная таблица доступна сразу. Рост ёмкости расширяет файл (ftruncate)
+       и отображение (mremap). Поддерживаются только тривиально копируемые типы.
+       Интерфейс и итератор совпадают с Vector; копирование запрещено (два объекта на одном файле). */
+    template<typename T>
+    class MappedVector
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "Error! MappedVector requires a trivially copyable type.");
+        static_assert(alignof(T) <= 64, "Error! MappedVector does not support types aligned to more than 64 bytes.");
+
+    private:
+        /* === Заголовок файла (64 байта, элементы начинаются сразу за ним): === */
+        struct Header
+        {
+            char     magic[8];          // Сигнатура файла.
+            uint64_t typeTag;           // Метка типа элементов (MappedTypeTag<T>).
+            uint64_t elementSize;       // Размер одного элемента в байтах.
+            uint64_t size;              // Текущий размер вектора.
+            uint64_t capacity;          // Текущая ёмкость вектора (под неё выделено место в файле).
+            uint64_t reserved[3];       // Зарезервировано.
+        };
+
+        static_assert(sizeof(Header) == 64, "Error! Unexpected MappedVector header size.");
+        static constexpr char signature[8] = { 'C', 'N', 'T', 'M', 'V', 'E', 'C', '1' };
+
+
+        /* === Данные вектора: === */
+        std::string filePath;           // Путь к файлу.
+        int         descriptor = -1;    // Дескриптор открытого файла.
+        Header*     header     = nullptr; // Начало отображения (заголовок).
+        T*          objects    = nullptr; // Элементы (сразу за заголовком).
+        size_t      mappedBytes = 0;    // Размер отображения в байтах.
+
+
+        /* === Вспомогательные методы для управления файлом и отображением: === */
+        static size_t bytesFor(size_t capacity);        // Размер файла для заданной ёмкости.
+        void mapFile(size_t bytes);                     // Отображение первых bytes байт файла в память.
+        void remapFile(size_t newCapacity);             // Расширение или сжатие файла и отображения.
+        void closeFile();                               // Снятие отображения и закрытие файла.
+        void ensureCapacity(size_t required);           // Рост ёмкости (не менее чем вдвое) до required.
+        T*   openGap(size_t index, size_t count);       // Сдвиг хвоста вправо, возвращает указатель на освободившееся место.
+        T*   firstObject() const;                       // Начало элементов (для перемещённого объекта - пустая заглушка).
+
+
+    public:
+        /* === Итератор (тот же, что у Vector): === */
+        using Iterator = typename Vector<T>::Iterator;
+
+
+        /* === Методы для получения итераторов на начало и конец вектора: === */
+        Iterator begin() const;
+        Iterator end()   const;
+
+
+        /* === Конструкторы и деструктор: === */
+        explicit MappedVector(const std::string& path, size_t initialCapacity = 10); // Открытие файла (создаётся, если его нет).
+
+        MappedVector(const MappedVector&) = delete;             // Копирование запрещено.
+        MappedVector& operator=(const MappedVector&) = delete;  // Присваивание копированием запрещено.
+
+        MappedVector(MappedVector&& other) noexcept;            // Конструктор перемещения.
+        MappedVector& operator=(MappedVector&& other) noexcept; // Оператор присваивания перемещением.
+
+        ~MappedVector();                                        // Деструктор (данные остаются в файле).
+
+
+        /* === Перегруженные операторы: === */
+        bool operator<<(const T& value) const;          // Оператор проверки наличия элемента в векторе.
+
+
+        /* === Методы для добавления и удаления элементов: === */
+        void pushBack(const T& value);                  // Добавление элемента в конец вектора.
+        void pushBack(const std::initializer_list<T>&); // Добавление диапазона элементов в конец вектора.
+
+        template<typename... Args>
+        T&   emplaceBack(Args&&... args);               // Создание элемента в конце вектора.
+        T    popBack();                                 // Удаление последнего элемента из вектора.
+
+        template<typename InputIt>
+        void append(InputIt first, InputIt last);       // Добавление диапазона элементов в конец вектора.
+
+        Iterator insert(Iterator pos, const T& value);  // Вставка элемента перед позицией pos.
+        template<typename InputIt>
+        Iterator insert(Iterator pos, InputIt first, InputIt last); // Вставка диапазона элементов перед позицией pos.
+
+        Iterator erase(Iterator pos);                   // Удаление элемента в позиции pos.
+        Iterator erase(Iterator first, Iterator last);  // Удаление диапазона элементов [first, last).
+        void     clear();                               // Удаление всех элементов (ёмкость сохраняется).
+
+
+        /* === Методы для управления размером и ёмкостью вектора: === */
+        void reserve(size_t newCapacity);               // Увеличение ёмкости до заданной (не меньше).
+        void resize(size_t newSize);                    // Изменение размера (новые элементы создаются по умолчанию).
+        void resize(size_t newSize, const T& value);    // Изменение размера (новые элементы - копии value).
+        void shrinkToFit();                             // Уменьшение ёмкости (и файла) до текущего размера.
+        void flush();                                   // Синхронная запись изменений на диск (msync).
+
+
+        /* === Методы доступа к элементам вектора: === */
+        T& at(size_t index);                            // Обращение к элементу с проверкой границ.
+        T& operator[](size_t index);                    // Обращение к элементу без проверки границ.
+        T  front() const;                               // Получение первого элемента вектора.
+        T  back()  const;                               // Получение последнего элемента вектора.
+
+
+        /* === Методы для поиска элементов в векторе (векторизованы для арифметических типов): === */
+        T*             find(const T& value) const;      // Указатель на первый элемент со значением value (nullptr, если не найден).
+        std::ptrdiff_t indexOf(const T& value) const;   // Индекс первого элемента со значением value (-1, если не найден).
+        size_t         count(const T& value) const;     // Количество элементов со значением value.
+        T              minElement() const;              // Получение минимального элемента вектора.
+        T              maxElement() const;              // Получение максимального элемента вектора.
+
+
+        /* === Методы для получения информации о векторе: === */
+        bool   isEmpty()  const;                        // Проверка на пустоту вектора.
+        size_t capacity() const;                        // Получение текущей ёмкости вектора.
+        size_t size()     const;                        // Получение текущего размера вектора.
+
+        const std::string& path() const;                // Получение пути к файлу.
+    };
+
+} // namespace Containers.
+
+
+
+/* ... ОПРЕДЕЛЕНИЕ ФУНКЦИОНАЛЬНОСТИ КЛАССА ... */
+namespace Containers
+{
+
+    /* === Вспомогательные защищенные методы для управления файлом и отображением: === */
+    template<typename T>
+    size_t MappedVector<T>::bytesFor(size_t capacity) { return sizeof(Header) + capacity * sizeof(T); }
+
+    template<typename T>
+    void MappedVector<T>::mapFile(size_t bytes)
+    {
+        void* address = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+        if (address == MAP_FAILED) {
+            throw std::runtime_error("Error! Cannot map file '" + filePath + "' into memory.");
+        }
+
+        header = static_cast<Header*>(address);
+        objects = reinterpret_cast<T*>(header + 1);
+        mappedBytes = bytes;
+    }
+
+    template<typename T>
+    void MappedVector<T>::remapFile(size_t newCapacity)
+    {
+        // Ёмкость не бывает нулевой, чтобы указатель на элементы всегда был корректным для итератора.
+        if (header == nullptr) {
+            throw std::runtime_error("Error! The vector is not attached to a file.");
+        }
+        if (newCapacity == 0) { newCapacity = 1; }
+        const size_t newBytes = bytesFor(newCapacity);
+
+        // При росте сначала расширяю файл (новая часть заполняется нулями и не занимает места до первой записи).
+        if (newBytes > mappedBytes && ::ftruncate(descriptor, static_cast<off_t>(newBytes)) != 0) {
+            throw std::runtime_error("Error! Cannot resize file '" + filePath + "'.");
+        }
+
+#ifdef __linux__
+        // mremap расширяет отображение на месте или переносит его, не копируя данные.
+        void* address = ::mremap(header, mappedBytes, newBytes, MREMAP_MAYMOVE);
+        if (address == MAP_FAILED) {
+            throw std::runtime_error("Error! Cannot remap file '" + filePath + "'.");
+        }
+
+        header = static_cast<Header*>(address);
+        objects = reinterpret_cast<T*>(header + 1);
+        mappedBytes = newBytes;
+#else
+        ::munmap(header, mappedBytes);
+        mapFile(newBytes);
+#endif
+
+        // При сжатии файл укорачивается уже после того, как отображение стало меньше.
+        if (newBytes < static_cast<size_t>(bytesFor(header->capacity))) {
+            if (::ftruncate(descriptor, static_cast<off_t>(newBytes)) != 0) {
+                throw std::runtime_error("Error! Cannot resize file '" + filePath + "'.");
+            }
+        }
+
+        header->capacity = newCapacity;
+    }
+
+    template<typename T>
+    void MappedVector<T>::closeFile()
+    {
+        if (header != nullptr) { ::munmap(header, mappedBytes); }
+        if (descriptor != -1)  { ::close(descriptor); }
+
+        header = nullptr;
+        objects = nullptr;
+        mappedBytes = 0;
+        descriptor = -1;
+    }
+
+    template<typename T>
+    T* MappedVector<T>::firstObject() const
+    {
+        /* Итератор не принимает nullptr, поэтому перемещённый объект отдаёт адрес статической заглушки:
+           begin() == end(), и она никогда не разыменовывается. */
+        static typename std::aligned_storage<sizeof(T), alignof(T)>::type placeholder;
+        return (objects != nullptr) ? objects : reinterpret_cast<T*>(&placeholder);
+    }
+
+    template<typename T>
+    void MappedVector<T>::ensureCapacity(size_t required)
+    {
+        // После перемещения объект не связан с файлом: читать и писать можно только через новый владелец.
+        if (header == nullptr) {
+            throw std::runtime_error("Error! The vector is not attached to a file.");
+        }
+        if (required <= header->capacity) { return; }
+
+        // Рост минимум вдвое, чтобы последовательные добавления были амортизированно O(1).
+        const size_t doubled = static_cast<size_t>(header->capacity) * 2;
+        remapFile(doubled > required ? doubled : required);
+    }
+
+    template<typename T>
+    T* MappedVector<T>::openGap(size_t index, size_t count)
+    {
+        if (index > this->size()) {
+            throw std::out_of_range("Error! Index is out of range.");
+        }
+
+        ensureCapacity(this->size() + count);
+        std::memmove(objects + index + count, objects + index, (header->size - index) * sizeof(T));
+
+        return objects + index;
+    }
+
+
+    /* === Публичные методы для получения итераторов на начало и конец вектора: === */
+    template<typename T> typename MappedVector<T>::Iterator MappedVector<T>::begin() const { return Iterator(firstObject()); }
+    template<typename T> typename MappedVector<T>::Iterator MappedVector<T>::end()   const { return Iterator(firstObject() + this->size()); }
+
+
+    /* === Конструкторы и деструктор: === */
+    template<typename T>
+    MappedVector<T>::MappedVector(const std::string& path, size_t initialCapacity) : filePath(path)
+    {
+        descriptor = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+        if (descriptor == -1) {
+            throw std::runtime_error("Error! Cannot open file '" + path + "'.");
+        }
+
+        try
+        {
+            struct stat info;
+            if (::fstat(descriptor, &info) != 0) {
+                throw std::runtime_error("Error! Cannot read attributes of file '" + path + "'.");
+            }
+
+            const size_t fileBytes = static_cast<size_t>(info.st_size);
+
+            // Новый (пустой) файл: выделяю место под начальную ёмкость и записываю заголовок.
+            if (fileBytes == 0)
+            {
+                if (initialCapacity == 0) { initialCapacity = 1; }
+
+                if (::ftruncate(descriptor, static_cast<off_t>(bytesFor(initialCapacity))) != 0) {
+                    throw std::runtime_error("Error! Cannot resize file '" + path + "'.");
+                }
+
+                mapFile(bytesFor(initialCapacity));
+
+                std::memcpy(header->magic, signature, sizeof(signature));
+                header->typeTag = MappedTypeTag<T>::value();
+                header->elementSize = sizeof(T);
+                header->size = 0;
+                header->capacity = initialCapacity;
+                return;
+            }
+
+            // Существующий файл: отображаю его целиком и проверяю заголовок - данные не читаются.
+            if (fileBytes < sizeof(Header)) {
+                throw std::runtime_error("Error! File '" + path + "' is not a MappedVector file.");
+            }
+
+            mapFile(fileBytes);
+
+            if (std::memcmp(header->magic, signature, sizeof(signature)) != 0) {
+                throw std::runtime_error("Error! File '" + path + "' is not a MappedVector file.");
+            }
+            if (header->typeTag != MappedTypeTag<T>::value() || header->elementSize != sizeof(T)) {
+                throw std::runtime_error("Error! File '" + path + "' stores elements of a different type.");
+            }
+            /* Ёмкость сравниваю с числом элементов, помещающихся в файл, а не bytesFor(capacity) с размером файла:
+               испорченное поле capacity могло бы переполнить произведение capacity * sizeof(T). */
+            const size_t fittingObjects = (fileBytes - sizeof(Header)) / sizeof(T);
+            if (header->capacity == 0 || header->capacity > fittingObjects || header->size > header->capacity) {
+                throw std::runtime_error("Error! File '" + path + "' is corrupted.");
+            }
+        }
+        catch (...)
+        {
+            closeFile();
+            throw;
+        }
+    }
+
+    template<typename T>
+    MappedVector<T>::MappedVector(MappedVector&& other) noexcept(true)
+        : filePath(std::move(other.filePath)), descriptor(other.descriptor), header(other.header),
+          objects(other.objects), mappedBytes(other.mappedBytes)
+    {
+        other.descriptor = -1;
+        other.header = nullptr;
+        other.objects = nullptr;
+        other.mappedBytes = 0;
+    }
+
+    template<typename T>
+    MappedVector<T>& MappedVector<T>::operator=(MappedVector&& other) noexcept(true)
+    {
+        if (this != &other)
+        {
+            closeFile();
+
+            filePath = std::move(other.filePath);
+            descriptor = other.descriptor;
+            header = other.header;
+            objects = other.objects;
+            mappedBytes = other.mappedBytes;
+
+            other.descriptor = -1;
+            other.header = nullptr;
+            other.objects = nullptr;
+            other.mappedBytes = 0;
+        }
+
+        return *this;
+    }
+
+    template<typename T>
+    MappedVector<T>::~MappedVector() { closeFile(); }
+
+
+    /* === Перегруженные операторы: === */
+    template<typename T>
+    bool MappedVector<T>::operator<<(const T& value) const { return this->indexOf(value) != -1; }
+
+
+    /* === Публичные методы для добавления и удаления элементов: === */
+    template<typename T>
+    void MappedVector<T>::pushBack(const T& value)
+    {
+        // Значение может лежать в этом же векторе, а отображение при росте может переехать - копирую его.
+        const T temp(value);
+
+        ensureCapacity(this->size() + 1);
+        objects[header->size] = temp;
+        ++header->size;
+    }
+
+    template<typename T>
+    void MappedVector<T>::pushBack(const std::initializer_list<T>& values) {
+        this->append(values.begin(), values.end());
+    }
+
+    template<typename T>
+    template<typename... Args>
+    T& MappedVector<T>::emplaceBack(Args&&... args)
+    {
+        const T temp(std::forward<Args>(args)...);
+
+        ensureCapacity(this->size() + 1);
+        objects[header->size] = temp;
+
+        return objects[header->size++];
+    }
+
+    template<typename T>
+    T MappedVector<T>::popBack()
+    {
+        if (this->isEmpty()) {
+            throw std::runtime_error("Error! You cannot delete an element from an empty vector.");
+        }
+
+        return objects[--header->size];
+    }
+
+    template<typename T>
+    template<typename InputIt>
+    void MappedVector<T>::append(InputIt first, InputIt last)
+    {
+        using Category = typename std::iterator_traits<InputIt>::iterator_category;
+
+        /* Для однопроходных итераторов размер диапазона заранее неизвестен - добавляю поэлементно.
+           Важно! Диапазон не должен принадлежать этому же вектору (отображение может переехать при росте). */
+        if constexpr (!std::is_base_of<std::forward_iterator_tag, Category>::value) {
+            for (; first != last; ++first) { this->pushBack(*first); }
+        }
+        else
+        {
+            const size_t count = static_cast<size_t>(std::distance(first, last));
+
+            ensureCapacity(this->size() + count);
+            std::copy(first, last, objects + header->size);
+            header->size += count;
+        }
+    }
+
+    template<typename T>
+    typename MappedVector<T>::Iterator MappedVector<T>::insert(Iterator pos, const T& value)
+    {
+        const T temp(value);
+        const size_t index = static_cast<size_t>(pos - begin());
+
+        *openGap(index, 1) = temp;
+        ++header->size;
+
+        return begin() + index;
+    }
+
+    template<typename T>
+    template<typename InputIt>
+    typename MappedVector<T>::Iterator MappedVector<T>::insert(Iterator pos, InputIt first, InputIt last)
+    {
+        using Category = typename std::iterator_traits<InputIt>::iterator_category;
+        const size_t index = static_cast<size_t>(pos - begin());
+
+        // Однопроходный диапазон сначала собираю во временный вектор, чтобы узнать его размер.
+        if constexpr (!std::is_base_of<std::forward_iterator_tag, Category>::value)
+        {
+            Vector<T> buffer;
+            buffer.append(first, last);
+
+            return insert(begin() + index, buffer.begin(), buffer.end());
+        }
+        else
+        {
+            // Важно! Диапазон не должен принадлежать этому же вектору.
+            const size_t count = static_cast<size_t>(std::distance(first, last));
+
+            std::copy(first, last, openGap(index, count));
+            header->size += count;
+
+            return begin() + index;
+        }
+    }
+
+    template<typename T>
+    typename MappedVector<T>::Iterator MappedVector<T>::erase(Iterator pos) {
+        return erase(pos, pos + 1);
+    }
+
+    template<typename T>
+    typename MappedVector<T>::Iterator MappedVector<T>::erase(Iterator first, Iterator last)
+    {
+        const size_t index = static_cast<size_t>(first - begin());
+        const size_t count = static_cast<size_t>(last - first);
+        if (count == 0) { return first; }
+
+        std::memmove(objects + index, objects + index + count, (header->size - index - count) * sizeof(T));
+        header->size -= count;
+
+        return begin() + index;
+    }
+
+    template<typename T>
+    void MappedVector<T>::clear() { if (header != nullptr) { header->size = 0; } }
+
+
+    /* === Публичные методы для управления размером и ёмкостью вектора: === */
+    template<typename T>
+    void MappedVector<T>::reserve(size_t newCapacity)
+    {
+        if (newCapacity > this->capacity()) {
+            remapFile(newCapacity);
+        }
+    }
+
+    template<typename T>
+    void MappedVector<T>::resize(size_t newSize) { this->resize(newSize, T()); }
+
+    template<typename T>
+    void MappedVector<T>::resize(size_t newSize, const T& value)
+    {
+        const T temp(value);
+
+        ensureCapacity(newSize);
+        for (size_t i = header->size; i < newSize; ++i) { objects[i] = temp; }
+
+        header->size = newSize;
+    }
+
+    template<typename T>
+    void MappedVector<T>::shrinkToFit()
+    {
+        if (this->capacity() > this->size()) {
+            remapFile(header->size);
+        }
+    }
+
+    template<typename T>
+    void MappedVector<T>::flush()
+    {
+        if (header == nullptr) { return; }
+        if (::msync(header, mappedBytes, MS_SYNC) != 0) {
+            throw std::runtime_error("Error! Cannot flush file '" + filePath + "' to disk.");
+        }
+    }
+
+
+    /* === Публичные методы доступа к элементам вектора: === */
+    template<typename T>
+    T& MappedVector<T>::at(size_t index)
+    {
+        if (index >= this->size()) {
+            throw std::out_of_range("Error! Index is out of range.");
+        }
+
+        return objects[index];
+    }
+
+    template<typename T>
+    T& MappedVector<T>::operator[](size_t index) { return objects[index]; }
+
+    template<typename T>
+    T MappedVector<T>::front() const
+    {
+        if (this->isEmpty()) {
+            throw std::runtime_error("Error! You cannot access the first element in an empty vector.");
+        }
+
+        return objects[0];
+    }
+
+    template<typename T>
+    T MappedVector<T>::back() const
+    {
+        if (this->isEmpty()) {
+            throw std::runtime_error("Error! You cannot access the last element in an empty vector.");
+        }
+
+        return objects[header->size - 1];
+    }
+
+
+    /* === Публичные методы для поиска элементов в векторе: === */
+    template<typename T>
+    T* MappedVector<T>::find(const T& value) const
+    {
+        const std::ptrdiff_t index = this->indexOf(value);
+        return (index == -1) ? nullptr : objects + index;
+    }
+
+    template<typename T>
+    std::ptrdiff_t MappedVector<T>::indexOf(const T& value) const
+    {
+        const size_t index = Simd::find(objects, this->size(), value);
+        return (index == this->size()) ? -1 : static_cast<std::ptrdiff_t>(index);
+    }
+
+    template<typename T>
+    size_t MappedVector<T>::count(const T& value) const {
+        return Simd::count(objects, this->size(), value);
+    }
+
+    template<typename T>
+    T MappedVector<T>::minElement() const
+    {
+        if (this->isEmpty()) {
+            throw std::runtime_error("Error! You cannot find the minimum element in an empty vector.");
+        }
+
+        return Simd::min(objects, this->size());
+    }
+
+    template<typename T>
+    T MappedVector<T>::maxElement() const
+    {
+        if (this->isEmpty()) {
+            throw std::runtime_error("Error! You cannot find the maximum element in an empty vector.");
+        }
+
+        return Simd::max(objects, this->size());
+    }
+
+
+    /* === Публичные методы для получения информации о векторе: === */
+    // Перемещённый объект (header == nullptr) ведёт себя как пустой вектор нулевой ёмкости.
+    template<typename T> bool   MappedVector<T>::isEmpty()  const { return this->size() == 0; }
+    template<typename T> size_t MappedVector<T>::capacity() const { return (header != nullptr) ? static_cast<size_t>(header->capacity) : 0; }
+    template<typename T> size_t MappedVector<T>::size()     const { return (header != nullptr) ? static_cast<size_t>(header->size) : 0; }
+
+    template<typename T> const std::string& MappedVector<T>::path() const { return filePath; }
+
+} // namespace Containers.
\ No newline at end of file
@@ -0,0 +1,396 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include "Vector.h"
+
+// Пространство имен Containers предназначено для хранения различных контейнеров.
+namespace Containers
+{
+    /* Packing - пространство имен с функциями упаковки целых чисел фиксированной ширины (bits бит)
+       в массив 64-битных слов. Значение с номером index занимает биты [index * bits, (index + 1) * bits)
+       и может переходить через границу двух соседних слов. */
+    namespace Packing
+    {
+        /* === Размер блока для поблочной распаковки (64 значения занимают ровно bits слов): === */
+        constexpr size_t blockSize = 64;
+
+
+        unsigned bitWidth(uint64_t value);                                              // Сколько бит нужно для value (0 для нуля).
+        uint64_t lowMask(unsigned bits);                                                // Маска младших bits бит.
+        size_t   wordsFor(size_t count, unsigned bits);                                 // Сколько слов занимают count значений.
+
+        uint64_t read (const uint64_t* words, size_t index, unsigned bits);             // Чтение значения.
+        void     write(uint64_t* words, size_t index, unsigned bits, uint64_t value);   // Запись значения (value должно помещаться в bits бит).
+        void     unpack(const uint64_t* words, size_t first, size_t count, unsigned bits, uint64_t* out); // Распаковка диапазона значений.
+
+    } // namespace Packing.
+
+
+    /* PackedVector - вектор беззнаковых целых, каждое из которых хранится ровно в Bits битах.
+       Например, идентификаторы, умещающиеся в 20 бит, занимают в 3.2 раза меньше памяти, чем в Vector<uint64_t>,
+       и проход по ним читает из памяти во столько же раз меньше байт. Элементы возвращаются по значению;
+       изменение элемента - через set(). Значение, не помещающееся в Bits бит, не добавляется (исключение). */
+    template<unsigned Bits>
+    class PackedVector
+    {
+        static_assert(Bits >= 1 && Bits <= 64, "Error! PackedVector width must be between 1 and 64 bits.");
+
+    private:
+        /* === Данные вектора: === */
+        Vector<uint64_t> words;                         // Упакованные значения.
+        size_t currSize = 0;                            // Количество значений.
+
+        static constexpr uint64_t mask = (Bits == 64) ? ~uint64_t(0) : ((uint64_t(1) << Bits) - 1);
+
+
+        /* === Вспомогательные методы: === */
+        const uint64_t* wordData() const;               // Начало массива слов.
+        void checkValue(uint64_t value) const;          // Проверка, что значение помещается в Bits бит.
+
+
+    public:
+        /* === Описание структуры итератора (только чтение): === */
+        class Iterator;
+
+
+        /* === Методы для получения итераторов на начало и конец вектора: === */
+        Iterator begin() const;
+        Iterator end()   const;
+
+
+        /* === Конструкторы: === */
+        PackedVector();                                             // Конструктор по умолчанию.
+        PackedVector(const std::initializer_list<uint64_t>& values); // Конструктор из списка инициализации.
+
+
+        /* === Перегруженные операторы: === */
+        bool     operator<<(uint64_t value) const;      // Оператор проверки наличия элемента в векторе (поблочно).
+        uint64_t operator[](size_t index) const;        // Получение значения без проверки границ.
+
+
+        /* === Методы для добавления, изменения и удаления элементов: === */
+        void     pushBack(uint64_t value);              // Добавление значения в конец вектора.
+        uint64_t popBack();                             // Удаление последнего значения из вектора.
+        void     set(size_t index, uint64_t value);     // Изменение значения с проверкой границ.
+        void     clear();                               // Удаление всех значений.
+        void     reserve(size_t newCapacity);           // Резервирование памяти под newCapacity значений.
+
+
+        /* === Методы доступа к элементам вектора: === */
+        uint64_t at(size_t index) const;                // Получение значения с проверкой границ.
+        uint64_t front() const;                         // Получение первого значения.
+        uint64_t back()  const;                         // Получение последнего значения.
+
+        void      decode(size_t first, size_t count, uint64_t* out) const; // Распаковка диапазона значений в массив.
+        Vector<uint64_t> toVector() const;              // Распакованная копия всех значений.
+
+
+        /* === Методы для получения информации о векторе: === */
+        bool   isEmpty() const;                         // Проверка на пустоту вектора.
+        size_t size()    const;                         // Получение текущего размера вектора.
+        size_t bytes()   const;                         // Объём памяти под упакованные значения (в байтах).
+    };
+
+} // namespace Containers.
+
+
+
+/* ... ОПРЕДЕЛЕНИЕ ФУНКЦИОНАЛЬНОСТИ ... */
+namespace Containers
+{
+    namespace Packing
+    {
+
+        inline unsigned bitWidth(uint64_t value)
+        {
+            unsigned bits = 0;
+
+            while (value != 0) { ++bits; value >>= 1; }
+
+            return bits;
+        }
+
+        inline uint64_t lowMask(unsigned bits) { return (bits >= 64) ? ~uint64_t(0) : ((uint64_t(1) << bits) - 1); }
+
+        inline size_t wordsFor(size_t count, unsigned bits) { return (count * bits + 63) / 64; }
+
+        inline uint64_t read(const uint64_t* words, size_t index, unsigned bits)
+        {
+            const size_t   bit    = index * bits;
+            const size_t   word   = bit / 64;
+            const unsigned offset = static_cast<unsigned>(bit % 64);
+
+            uint64_t value = words[word] >> offset;
+            if (offset + bits > 64) { value |= words[word + 1] << (64 - offset); }
+
+            return value & lowMask(bits);
+        }
+
+        inline void write(uint64_t* words, size_t index, unsigned bits, uint64_t value)
+        {
+            const size_t   bit    = index * bits;
+            const size_t   word   = bit / 64;
+            const unsigned offset = static_cast<unsigned>(bit % 64);
+            const uint64_t mask   = lowMask(bits);
+
+            words[word] = (words[word] & ~(mask << offset)) | (value << offset);
+
+            // Старшая часть значения попадает в следующее слово.
+            if (offset + bits > 64)
+            {
+                const unsigned rest = 64 - offset;
+                words[word + 1] = (words[word + 1] & ~(mask >> rest)) | (value >> rest);
+            }
+        }
+
+        inline void unpack(const uint64_t* words, size_t first, size_t count, unsigned bits, uint64_t* out)
+        {
+            if (bits == 0)
+            {
+                for (size_t i = 0; i < count; ++i) { out[i] = 0; }
+                return;
+            }
+
+            const uint64_t mask = lowMask(bits);
+            size_t bit = first * bits;
+
+            // Последовательное чтение без умножений: смещение растёт на bits на каждое значение.
+            for (size_t i = 0; i < count; ++i, bit += bits)
+            {
+                const size_t   word   = bit / 64;
+                const unsigned offset = static_cast<unsigned>(bit % 64);
+
+                uint64_t value = words[word] >> offset;
+                if (offset + bits > 64) { value |= words[word + 1] << (64 - offset); }
+
+                out[i] = value & mask;
+            }
+        }
+
+    } // namespace Packing.
+
+
+    /* === Описание структуры итератора: === */
+    template<unsigned Bits>
+    class PackedVector<Bits>::Iterator
+    {
+    private:
+        // Вектор и индекс текущего значения.
+        const PackedVector* vector;
+        size_t currIndex;
+
+    public:
+        // Информация об итераторе для совместимости со стандартными алгоритмами:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = uint64_t;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = void;
+        using reference         = uint64_t;
+
+        // Пользовательский конструктор:
+        Iterator(const PackedVector* inputVector, size_t index) : vector(inputVector), currIndex(index) {}
+
+        // Оператор разыменования:
+        reference operator*() const { return (*vector)[currIndex]; }
+
+        // Операторы инкрементирования и декрементирования:
+        Iterator& operator++()    { ++currIndex; return *this; }
+        Iterator  operator++(int) { Iterator temp = *this; ++currIndex; return temp; }
+        Iterator& operator--()    { --currIndex; return *this; }
+        Iterator  operator--(int) { Iterator temp = *this; --currIndex; return temp; }
+
+        // Арифметические операторы:
+        Iterator  operator+(difference_type n) const { return Iterator(vector, currIndex + n); }
+        Iterator  operator-(difference_type n) const { return Iterator(vector, currIndex - n); }
+
+        Iterator& operator+=(difference_type n) { currIndex += n; return *this; }
+        Iterator& operator-=(difference_type n) { currIndex -= n; return *this; }
+
+        difference_type operator-(const Iterator& other) const {
+            return static_cast<difference_type>(currIndex) - static_cast<difference_type>(other.currIndex);
+        }
+
+        // Операторы сравнения:
+        bool operator==(const Iterator& other) const { return currIndex == other.currIndex; }
+        bool operator!=(const Iterator& other) const { return currIndex != other.currIndex; }
+        bool operator<=(const Iterator& other) const { return currIndex <= other.currIndex; }
+        bool operator>=(const Iterator& other) const { return currIndex >= other.currIndex; }
+        bool operator< (const Iterator& other) const { return currIndex < other.currIndex;  }
+        bool operator> (const Iterator& other) const { return currIndex > other.currIndex;  }
+
+        // Оператор индексирования:
+        reference operator[](difference_type n) const { return (*vector)[currIndex + n]; }
+    };
+
+
+    /* === Вспомогательные защищенные методы: === */
+    template<unsigned Bits>
+    const uint64_t* PackedVector<Bits>::wordData() const { return &*words.begin(); }
+
+    template<unsigned Bits>
+    void PackedVector<Bits>::checkValue(uint64_t value) const
+    {
+        if ((value & ~mask) != 0) {
+            throw std::out_of_range("Error! Value does not fit into the packed width.");
+        }
+    }
+
+
+    /* === Публичные методы для получения итераторов на начало и конец вектора: === */
+    template<unsigned Bits> typename PackedVector<Bits>::Iterator PackedVector<Bits>::begin() const { return Iterator(this, 0); }
+    template<unsigned Bits> typename PackedVector<Bits>::Iterator PackedVector<Bits>::end()   const { return Iterator(this, currSize); }
+
+
+    /* === Конструкторы: === */
+    template<unsigned Bits>
+    PackedVector<Bits>::PackedVector() : words() {}
+
+    template<unsigned Bits>
+    PackedVector<Bits>::PackedVector(const std::initializer_list<uint64_t>& values) : words()
+    {
+        reserve(values.size());
+
+        for (uint64_t value : values) {
+            pushBack(value);
+        }
+    }
+
+
+    /* === Перегруженные операторы: === */
+    template<unsigned Bits>
+    bool PackedVector<Bits>::operator<<(uint64_t value) const
+    {
+        // Значение шире Bits бит заведомо отсутствует - распаковывать ничего не нужно.
+        if ((value & ~mask) != 0) { return false; }
+
+        // Распаковываю по блоку в буфер на стеке и ищу в нём векторизованным ядром.
+        uint64_t block[Packing::blockSize];
+
+        for (size_t first = 0; first < currSize; first += Packing::blockSize)
+        {
+            const size_t count = std::min(Packing::blockSize, currSize - first);
+
+            Packing::unpack(wordData(), first, count, Bits, block);
+            if (Simd::find(block, count, value) != count) { return true; }
+        }
+
+        return false;
+    }
+
+    template<unsigned Bits>
+    uint64_t PackedVector<Bits>::operator[](size_t index) const { return Packing::read(wordData(), index, Bits); }
+
+
+    /* === Публичные методы для добавления, изменения и удаления элементов: === */
+    template<unsigned Bits>
+    void PackedVector<Bits>::pushBack(uint64_t value)
+    {
+        checkValue(value);
+
+        // Новое значение может начать новое слово (или два, если переходит через границу).
+        const size_t required = Packing::wordsFor(currSize + 1, Bits);
+        while (words.size() < required) { words.pushBack(0); }
+
+        Packing::write(&words[0], currSize, Bits, value);
+        ++currSize;
+    }
+
+    template<unsigned Bits>
+    uint64_t PackedVector<Bits>::popBack()
+    {
+        if (this->isEmpty()) {
+            throw std::runtime_error("Error! You cannot delete an element from an empty vector.");
+        }
+
+        const uint64_t value = (*this)[currSize - 1];
+
+        // Обнуляю биты значения, чтобы освободившиеся слова можно было снова заполнять через pushBack.
+        Packing::write(&words[0], currSize - 1, Bits, 0);
+        --currSize;
+        words.resize(Packing::wordsFor(currSize, Bits));
+
+        return value;
+    }
+
+    template<unsigned Bits>
+    void PackedVector<Bits>::set(size_t index, uint64_t value)
+    {
+        if (index >= currSize) {
+            throw std::out_of_range("Error! Index is out of range.");
+        }
+
+        checkValue(value);
+        Packing::write(&words[0], index, Bits, value);
+    }
+
+    template<unsigned Bits>
+    void PackedVector<Bits>::clear()
+    {
+        words.clear();
+        currSize = 0;
+    }
+
+    template<unsigned Bits>
+    void PackedVector<Bits>::reserve(size_t newCapacity) { words.reserve(Packing::wordsFor(newCapacity, Bits)); }
+
+
+    /* === Публичные методы доступа к элементам вектора: === */
+    template<unsigned Bits>
+    uint64_t PackedVector<Bits>::at(size_t index) const
+    {
+        if (index >= currSize) {
+            throw std::out_of_range("Error! Index is out of range.");
+        }
+
+        return (*this)[index];
+    }
+
+    template<unsigned Bits>
+    uint64_t PackedVector<Bits>::front() const
+    {
+        if (this->isEmpty()) {
+            throw std::runtime_error("Error! You cannot access the first element in an empty vector.");
+        }
+
+        return (*this)[0];
+    }
+
+    template<unsigned Bits>
+    uint64_t PackedVector<Bits>::back() const
+    {
+        if (this->isEmpty()) {
+            throw std::runtime_error("Error! You cannot access the last element in an empty vector.");
+        }
+
+        return (*this)[currSize - 1];
+    }
+
+    template<unsigned Bits>
+    void PackedVector<Bits>::decode(size_t first, size_t count, uint64_t* out) const
+    {
+        if (first > currSize || count > currSize - first) {
+            throw std::out_of_range("Error! Index is out of range.");
+        }
+
+        Packing::unpack(wordData(), first, count, Bits, out);
+    }
+
+    template<unsigned Bits>
+    Vector<uint64_t> PackedVector<Bits>::toVector() const
+    {
+        Vector<uint64_t> result;
+        result.resize(currSize);
+
+        if (currSize != 0) { decode(0, currSize, &result[0]); }
+
+        return result;
+    }
+
+
+    /* === Публичные методы для получения информации о векторе: === */
+    template<unsigned Bits> bool   PackedVector<Bits>::isEmpty() const { return currSize == 0; }
+    template<unsigned Bits> size_t PackedVector<Bits>::size()    const { return currSize; }
+    template<unsigned Bits> size_t PackedVector<Bits>::bytes()   const { return words.size() * sizeof(uint64_t); }
+
+} // namespace Containers.
@@ -0,0 +1,386 @@
+#pragma once
+#include <atomic>
+#include "Vector.h"
+
+// Пространство имен Containers предназначено для хранения различных контейнеров.
+namespace Containers
+{
+    /* SharedVector - вектор с копированием при записи (copy-on-write).
+       Копии SharedVector разделяют один буфер элементов со счётчиком ссылок, поэтому копирование - O(1):
+       снимок данных можно раздать любому числу читателей (в том числе в других потоках) без копирования.
+       Буфер клонируется только при первом изменяющем вызове (pushBack, неконстантные operator[] и at, ...),
+       если в этот момент им пользуется кто-то ещё. Константные методы никогда не копируют данные.
+       Важно! После выдачи изменяемой ссылки (неконстантные operator[] и at, emplaceBack) буфер помечается как неразделяемый:
+       иначе запись через сохранённую ссылку изменила бы и последующие копии. Такой вектор копируется
+       полностью, пока метка не снята (clear() или отказ от буфера).
+       Один объект SharedVector, как и Vector, нельзя изменять из нескольких потоков одновременно. */
+    template<typename T>
+    class SharedVector
+    {
+    private:
+        /* === Разделяемый буфер: === */
+        struct Shared
+        {
+            std::atomic<size_t> references{ 1 };    // Количество SharedVector, использующих буфер.
+            bool unshareable = false;               // Выдавались изменяемые ссылки (меняется только единственным владельцем).
+            Vector<T> elements;                     // Элементы.
+
+            Shared() = default;
+            explicit Shared(const Vector<T>& values) : elements(values) {}
+            explicit Shared(Vector<T>&& values) : elements(std::move(values)) {}
+        };
+
+
+        /* === Данные вектора: === */
+        Shared* shared = nullptr;                   // Разделяемый буфер (nullptr - пустой вектор).
+
+
+        /* === Вспомогательные методы: === */
+        void release();                             // Отказ от буфера (удаляется последним владельцем).
+        static Shared* share(Shared* source);       // Буфер для копии: тот же (счётчик + 1) или клон неразделяемого.
+        Vector<T>& mutableElements();               // Единоличный доступ к элементам (клонирует буфер при необходимости).
+
+
+    public:
+        /* === Конструкторы и деструктор: === */
+        SharedVector();                                         // Конструктор по умолчанию (без выделения памяти).
+        SharedVector(const std::initializer_list<T>& values);   // Конструктор из списка инициализации.
+        explicit SharedVector(const Vector<T>& values);         // Конструктор из вектора (копирование).
+        explicit SharedVector(Vector<T>&& values);              // Конструктор из вектора (перемещение).
+
+        SharedVector(const SharedVector& other);                // Конструктор копирования (O(1), буфер общий, если он не неразделяемый).
+        SharedVector(SharedVector&& other) noexcept;            // Конструктор перемещения.
+
+        ~SharedVector();                                        // Деструктор.
+
+
+        /* === Перегруженные операторы: === */
+        SharedVector& operator=(const SharedVector& other);     // Оператор присваивания копированием (O(1), если буфер не неразделяемый).
+        SharedVector& operator=(SharedVector&& other) noexcept; // Оператор присваивания перемещением.
+        bool          operator<<(const T& value) const;         // Оператор проверки наличия элемента в векторе.
+
+
+        /* === Методы для добавления и удаления элементов (клонируют общий буфер): === */
+        void pushBack(const T& value);                          // Добавление копии элемента в конец вектора.
+        void pushBack(T&& value);                               // Добавление элемента в конец вектора перемещением.
+
+        template<typename... Args>
+        T&   emplaceBack(Args&&... args);                       // Создание элемента на месте в конце вектора (делает буфер неразделяемым).
+        T    popBack();                                         // Удаление последнего элемента из вектора.
+        void clear();                                           // Удаление всех элементов.
+        void reserve(size_t newCapacity);                       // Увеличение ёмкости до заданной (не меньше).
+        void resize(size_t newSize);                            // Изменение размера.
+
+
+        /* === Методы доступа к элементам: === */
+        T&       at(size_t index);                              // Изменяемый элемент с проверкой границ (клонирует общий буфер, делает его неразделяемым).
+        T&       operator[](size_t index);                      // Изменяемый элемент без проверки границ (клонирует общий буфер, делает его неразделяемым).
+        const T& at(size_t index) const;                        // Элемент для чтения с проверкой границ.
+        const T& operator[](size_t index) const;                // Элемент для чтения без проверки границ.
+        T        front() const;                                 // Получение первого элемента вектора.
+        T        back()  const;                                 // Получение последнего элемента вектора.
+
+        const T* cbegin() const;                                // Начало элементов для чтения.
+        const T* cend()   const;                                // Конец элементов для чтения.
+        const T* begin()  const;                                // Начало элементов для чтения (для range-for).
+        const T* end()    const;                                // Конец элементов для чтения (для range-for).
+
+
+        /* === Методы для поиска элементов (без копирования): === */
+        std::ptrdiff_t indexOf(const T& value) const;           // Индекс первого элемента со значением value (-1, если не найден).
+        size_t         count(const T& value) const;             // Количество элементов со значением value.
+        T              minElement() const;                      // Получение минимального элемента вектора.
+        T              maxElement() const;                      // Получение максимального элемента вектора.
+
+
+        /* === Методы для получения информации о векторе: === */
+        bool   isEmpty()  const;                                // Проверка на пустоту вектора.
+        size_t size()     const;                                // Получение текущего размера вектора.
+        size_t useCount() const;                                // Количество SharedVector, разделяющих буфер.
+        bool   isShared() const;                                // Разделяется ли буфер с другими объектами.
+
+        Vector<T> toVector() const;                             // Независимая копия элементов.
+    };
+
+} // namespace Containers.
+
+
+
+/* ... ОПРЕДЕЛЕНИЕ ФУНКЦИОНАЛЬНОСТИ КЛАССА ... */
+namespace Containers
+{
+
+    /* === Вспомогательные защищенные методы: === */
+    template<typename T>
+    void SharedVector<T>::release()
+    {
+        // acq_rel: последний владелец должен видеть все изменения, сделанные до отказа от буфера другими потоками.
+        if (shared != nullptr && shared->references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete shared;
+        }
+
+        shared = nullptr;
+    }
+
+    template<typename T>
+    typename SharedVector<T>::Shared* SharedVector<T>::share(Shared* source)
+    {
+        if (source == nullptr) { return nullptr; }
+
+        // На неразделяемый буфер могут указывать сохранённые изменяемые ссылки - копия получает собственные данные.
+        if (source->unshareable) { return new Shared(source->elements); }
+
+        source->references.fetch_add(1, std::memory_order_relaxed);
+        return source;
+    }
+
+    template<typename T>
+    Vector<T>& SharedVector<T>::mutableElements()
+    {
+        if (shared == nullptr) {
+            shared = new Shared();
+        }
+        // Буфером пользуется кто-то ещё - делаю собственную копию (единственный момент копирования).
+        else if (shared->references.load(std::memory_order_acquire) != 1)
+        {
+            Shared* copy = new Shared(shared->elements);
+            release();
+            shared = copy;
+        }
+
+        return shared->elements;
+    }
+
+
+    /* === Конструкторы и деструктор: === */
+    template<typename T>
+    SharedVector<T>::SharedVector() = default;
+
+    template<typename T>
+    SharedVector<T>::SharedVector(const std::initializer_list<T>& values) : shared(new Shared(Vector<T>(values))) {}
+
+    template<typename T>
+    SharedVector<T>::SharedVector(const Vector<T>& values) : shared(new Shared(values)) {}
+
+    template<typename T>
+    SharedVector<T>::SharedVector(Vector<T>&& values) : shared(new Shared(std::move(values))) {}
+
+    template<typename T>
+    SharedVector<T>::SharedVector(const SharedVector& other) : shared(share(other.shared)) {}
+
+    template<typename T>
+    SharedVector<T>::SharedVector(SharedVector&& other) noexcept(true) : shared(other.shared) {
+        other.shared = nullptr;
+    }
+
+    template<typename T>
+    SharedVector<T>::~SharedVector() { release(); }
+
+
+    /* === Перегруженные операторы: === */
+    template<typename T>
+    SharedVector<T>& SharedVector<T>::operator=(const SharedVector& other)
+    {
+        // Самоприсваивание ничего не меняет (а неразделяемый буфер иначе был бы скопирован).
+        if (this == &other) { return *this; }
+
+        // Сначала захватываю чужой буфер, затем отпускаю свой (корректно, если буфер у них общий).
+
+        Shared* next = share(other.shared);
+        Shared* previous = shared;
+        shared = next;
+
+        if (previous != nullptr && previous->references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete previous;
+        }
+
+        return *this;
+    }
+
+    template<typename T>
+    SharedVector<T>& SharedVector<T>::operator=(SharedVector&& other) noexcept(true)
+    {
+        if (this != &other)
+        {
+            release();
+            shared = other.shared;
+            other.shared = nullptr;
+        }
+
+        return *this;
+    }
+
+    template<typename T>
+    bool SharedVector<T>::operator<<(const T& value) const { return this->indexOf(value) != -1; }
+
+
+    /* === Публичные методы для добавления и удаления элементов: === */
+    template<typename T>
+    void SharedVector<T>::pushBack(const T& value)
+    {
+        // Значение может ссылаться на элемент общего буфера, который освободится при клонировании - копирую его.
+        T temp(value);
+        mutableElements().pushBack(std::move(temp));
+    }
+
+    template<typename T>
+    void SharedVector<T>::pushBack(T&& value) { mutableElements().pushBack(std::move(value)); }
+
+    template<typename T>
+    template<typename... Args>
+    T& SharedVector<T>::emplaceBack(Args&&... args)
+    {
+        T temp(std::forward<Args>(args)...);
+        T& result = mutableElements().emplaceBack(std::move(temp));
+
+        // Возвращается изменяемая ссылка - как и после operator[], буфер больше нельзя разделять.
+        shared->unshareable = true;
+        return result;
+    }
+
+    template<typename T>
+    T SharedVector<T>::popBack()
+    {
+        if (this->isEmpty()) {
+            throw std::runtime_error("Error! You cannot delete an element from an empty vector.");
+        }
+
+        return mutableElements().popBack();
+    }
+
+    template<typename T>
+    void SharedVector<T>::clear()
+    {
+        // Очистка общего буфера не требует его копирования - достаточно отказаться от него.
+        // Ссылок на удалённые элементы больше нет, поэтому буфер снова можно разделять.
+        if (isShared()) { release(); }
+        else if (shared != nullptr)
+        {
+            shared->elements.clear();
+            shared->unshareable = false;
+        }
+    }
+
+    template<typename T>
+    void SharedVector<T>::reserve(size_t newCapacity) { mutableElements().reserve(newCapacity); }
+
+    template<typename T>
+    void SharedVector<T>::resize(size_t newSize) { mutableElements().resize(newSize); }
+
+
+    /* === Публичные методы доступа к элементам: === */
+    template<typename T>
+    T& SharedVector<T>::at(size_t index)
+    {
+        if (index >= size()) {
+            throw std::out_of_range("Error! Index is out of range.");
+        }
+
+        return this->operator[](index);
+    }
+
+    template<typename T>
+    T& SharedVector<T>::operator[](size_t index)
+    {
+        // Ссылка переживёт этот вызов: следующие копии не должны разделять буфер, в который по ней можно писать.
+        Vector<T>& elements = mutableElements();
+        shared->unshareable = true;
+
+        return elements[index];
+    }
+
+    template<typename T>
+    const T& SharedVector<T>::at(size_t index) const
+    {
+        if (index >= size()) {
+            throw std::out_of_range("Error! Index is out of range.");
+        }
+
+        return cbegin()[index];
+    }
+
+    template<typename T>
+    const T& SharedVector<T>::operator[](size_t index) const { return cbegin()[index]; }
+
+    template<typename T>
+    T SharedVector<T>::front() const
+    {
+        if (this->isEmpty()) {
+            throw std::runtime_error("Error! You cannot access the first element in an empty vector.");
+        }
+
+        return cbegin()[0];
+    }
+
+    template<typename T>
+    T SharedVector<T>::back() const
+    {
+        if (this->isEmpty()) {
+            throw std::runtime_error("Error! You cannot access the last element in an empty vector.");
+        }
+
+        return cend()[-1];
+    }
+
+    template<typename T>
+    const T* SharedVector<T>::cbegin() const
+    {
+        // Пустой буфер (например, из перемещённого вектора) может не иметь памяти: итератор на него не разыменовать.
+        return (shared == nullptr || shared->elements.size() == 0) ? nullptr : &*shared->elements.begin();
+    }
+
+    template<typename T>
+    const T* SharedVector<T>::cend() const { return (shared == nullptr) ? nullptr : cbegin() + shared->elements.size(); }
+
+    template<typename T> const T* SharedVector<T>::begin() const { return cbegin(); }
+    template<typename T> const T* SharedVector<T>::end()   const { return cend();   }
+
+
+    /* === Публичные методы для поиска элементов: === */
+    template<typename T>
+    std::ptrdiff_t SharedVector<T>::indexOf(const T& value) const {
+        return (shared == nullptr) ? -1 : shared->elements.indexOf(value);
+    }
+
+    template<typename T>
+    size_t SharedVector<T>::count(const T& value) const {
+        return (shared == nullptr) ? 0 : shared->elements.count(value);
+    }
+
+    template<typename T>
+    T SharedVector<T>::minElement() const
+    {
+        if (this->isEmpty()) {
+            throw std::runtime_error("Error! You cannot find the minimum element in an empty vector.");
+        }
+
+        return shared->elements.minElement();
+    }
+
+    template<typename T>
+    T SharedVector<T>::maxElement() const
+    {
+        if (this->isEmpty()) {
+            throw std::runtime_error("Error! You cannot find the maximum element in an empty vector.");
+        }
+
+        return shared->elements.maxElement();
+    }
+
+
+    /* === Публичные методы для получения информации о векторе: === */
+    template<typename T> bool   SharedVector<T>::isEmpty() const { return size() == 0; }
+    template<typename T> size_t SharedVector<T>::size()    const { return (shared == nullptr) ? 0 : shared->elements.size(); }
+
+    template<typename T>
+    size_t SharedVector<T>::useCount() const {
+        return (shared == nullptr) ? 0 : shared->references.load(std::memory_order_acquire);
+    }
+
+    template<typename T>
+    bool SharedVector<T>::isShared() const { return useCount() > 1; }
+
+    template<typename T>
+    Vector<T> SharedVector<T>::toVector() const { return (shared == nullptr) ? Vector<T>() : shared->elements; }
+
+} // namespace Containers.
\ No newline at end of file
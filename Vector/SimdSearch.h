@@ -0,0 +1,624 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/* Векторные ядра собираются только для x86 и компиляторов GCC/Clang: они выбираются во время выполнения
+   (по возможностям процессора), поэтому сам проект можно собирать без флагов -mavx2 / -mavx512f. */
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+    #define CONTAINERS_SIMD_X86 1
+    #include <immintrin.h>
+#else
+    #define CONTAINERS_SIMD_X86 0
+#endif
+
+// Пространство имен Containers предназначено для хранения различных контейнеров.
+namespace Containers
+{
+    /* Simd - пространство имен с ядрами линейного поиска по непрерывному массиву
+       (поиск значения, подсчет вхождений, минимум и максимум).
+       Для арифметических типов с элементами размером 4 и 8 байт используются SSE2 / AVX2 / AVX-512,
+       для всех остальных типов - обычный скалярный цикл (через операторы == и <). */
+    namespace Simd
+    {
+        /* === Уровни набора инструкций: === */
+        enum class Level { Scalar, SSE2, AVX2, AVX512 };
+
+        Level detectLevel();                // Определение максимального уровня, поддерживаемого процессором.
+        Level activeLevel();                // Уровень, используемый ядрами на текущий момент.
+        void  setLevel(Level requested);    // Принудительный выбор уровня (не выше поддерживаемого) - например, для замеров.
+
+
+        /* === Скалярные ядра (подходят для любого типа T): === */
+        template<typename T> size_t findScalar (const T* data, size_t size, const T& value); // Индекс первого вхождения (size, если нет).
+        template<typename T> size_t countScalar(const T* data, size_t size, const T& value); // Количество вхождений.
+        template<typename T> T      minScalar  (const T* data, size_t size);                 // Минимум (size > 0).
+        template<typename T> T      maxScalar  (const T* data, size_t size);                 // Максимум (size > 0).
+
+
+        /* === Ядра с выбором реализации во время выполнения: === */
+        template<typename T> size_t find (const T* data, size_t size, const T& value);
+        template<typename T> size_t count(const T* data, size_t size, const T& value);
+        template<typename T> T      min  (const T* data, size_t size);
+        template<typename T> T      max  (const T* data, size_t size);
+
+    } // namespace Simd.
+
+} // namespace Containers.
+
+
+
+/* ... ОПРЕДЕЛЕНИЕ ФУНКЦИОНАЛЬНОСТИ ... */
+namespace Containers
+{
+    namespace Simd
+    {
+
+        /* === Скалярные ядра: === */
+        template<typename T>
+        size_t findScalar(const T* data, size_t size, const T& value)
+        {
+            for (size_t i = 0; i < size; ++i) {
+                if (data[i] == value) return i;
+            }
+
+            return size;
+        }
+
+        template<typename T>
+        size_t countScalar(const T* data, size_t size, const T& value)
+        {
+            size_t result = 0;
+
+            for (size_t i = 0; i < size; ++i) {
+                result += (data[i] == value);
+            }
+
+            return result;
+        }
+
+        template<typename T>
+        T minScalar(const T* data, size_t size)
+        {
+            T best = data[0];
+
+            for (size_t i = 1; i < size; ++i) {
+                if (data[i] < best) best = data[i];
+            }
+
+            return best;
+        }
+
+        template<typename T>
+        T maxScalar(const T* data, size_t size)
+        {
+            T best = data[0];
+
+            for (size_t i = 1; i < size; ++i) {
+                if (best < data[i]) best = data[i];
+            }
+
+            return best;
+        }
+
+
+        /* === Определение и выбор уровня набора инструкций: === */
+        inline Level detectLevel()
+        {
+        #if CONTAINERS_SIMD_X86
+            __builtin_cpu_init();
+
+            if (__builtin_cpu_supports("avx512f")) return Level::AVX512;
+            if (__builtin_cpu_supports("avx2"))    return Level::AVX2;
+            if (__builtin_cpu_supports("sse2"))    return Level::SSE2;
+        #endif
+
+            return Level::Scalar;
+        }
+
+        // Хранилище текущего уровня (определяется один раз при первом обращении).
+        inline Level& currentLevel()
+        {
+            static Level level = detectLevel();
+            return level;
+        }
+
+        inline Level activeLevel() { return currentLevel(); }
+
+        inline void setLevel(Level requested)
+        {
+            // Уровень выше поддерживаемого процессором выбрать нельзя - иначе будет недопустимая инструкция.
+            const Level supported = detectLevel();
+            currentLevel() = (static_cast<int>(requested) > static_cast<int>(supported)) ? supported : requested;
+        }
+
+
+        /* LaneType - тип "дорожки" векторного регистра, соответствующий типу T.
+           Целые типы сводятся к целым фиксированной ширины с тем же представлением (int / long / long long и т.д.),
+           для неподдерживаемых типов LaneType - void (используются скалярные ядра). */
+        template<typename T, typename = void>
+        struct LaneType { using type = void; };
+
+        template<typename T>
+        struct LaneType<T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value
+                                                   && (sizeof(T) == 4 || sizeof(T) == 8)>::type>
+        {
+            using Signed   = typename std::conditional<sizeof(T) == 4, int32_t,  int64_t >::type;
+            using Unsigned = typename std::conditional<sizeof(T) == 4, uint32_t, uint64_t>::type;
+            using type     = typename std::conditional<std::is_signed<T>::value, Signed, Unsigned>::type;
+        };
+
+        template<> struct LaneType<float>  { using type = float;  };
+        template<> struct LaneType<double> { using type = double; };
+
+
+    #if CONTAINERS_SIMD_X86
+
+        /* Обобщённые векторные ядра. Макрос разворачивается в пространстве имен конкретного набора инструкций,
+           где определены структуры Ops<Lane> (загрузка, сравнение, минимум/максимум для регистра этого набора).
+           Все функции помечаются атрибутом target, чтобы компилятор встроил в них соответствующие инструкции. */
+        #define CONTAINERS_SIMD_DEFINE_KERNELS(TARGET)                                                          \
+            template<typename Lane>                                                                             \
+            __attribute__((target(TARGET))) size_t findKernel(const Lane* data, size_t size, Lane value)        \
+            {                                                                                                   \
+                using O = Ops<Lane>;                                                                            \
+                const auto key = O::broadcast(value);                                                           \
+                size_t i = 0;                                                                                   \
+                                                                                                                \
+                /* Основной цикл обрабатывает 4 регистра за итерацию, чтобы скрыть задержку сравнений. */       \
+                for (; i + 4 * O::width <= size; i += 4 * O::width)                                             \
+                {                                                                                               \
+                    const unsigned m0 = O::equalMask(O::load(data + i),                key);                    \
+                    const unsigned m1 = O::equalMask(O::load(data + i + O::width),     key);                    \
+                    const unsigned m2 = O::equalMask(O::load(data + i + 2 * O::width), key);                    \
+                    const unsigned m3 = O::equalMask(O::load(data + i + 3 * O::width), key);                    \
+                                                                                                                \
+                    if ((m0 | m1 | m2 | m3) != 0)                                                               \
+                    {                                                                                           \
+                        if (m0 != 0) return i                + __builtin_ctz(m0);                             \
+                        if (m1 != 0) return i + O::width     + __builtin_ctz(m1);                               \
+                        if (m2 != 0) return i + 2 * O::width + __builtin_ctz(m2);                               \
+                        return i + 3 * O::width + __builtin_ctz(m3);                                            \
+                    }                                                                                           \
+                }                                                                                               \
+                                                                                                                \
+                for (; i + O::width <= size; i += O::width)                                                     \
+                {                                                                                               \
+                    const unsigned mask = O::equalMask(O::load(data + i), key);                                 \
+                    if (mask != 0) return i + __builtin_ctz(mask);                                              \
+                }                                                                                               \
+                                                                                                                \
+                return i + findScalar(data + i, size - i, value);                                               \
+            }                                                                                                   \
+                                                                                                                \
+            template<typename Lane>                                                                             \
+            __attribute__((target(TARGET))) size_t countKernel(const Lane* data, size_t size, Lane value)       \
+            {                                                                                                   \
+                using O = Ops<Lane>;                                                                            \
+                const auto key = O::broadcast(value);                                                           \
+                size_t result = 0, i = 0;                                                                       \
+                                                                                                                \
+                for (; i + O::width <= size; i += O::width) {                                                   \
+                    result += maskPopcount(O::equalMask(O::load(data + i), key));                               \
+                }                                                                                               \
+                                                                                                                \
+                return result + countScalar(data + i, size - i, value);                                         \
+            }                                                                                                   \
+                                                                                                                \
+            /* Минимум и максимум. Порядок аргументов min/max выбран так, чтобы каждая дорожка вела себя как    \
+               скалярный цикл (x < best). Если в данных встретился NaN, результат векторного и скалярного      \
+               порядков обхода может различаться, поэтому в этом случае пересчитываю скалярно. */              \
+            template<typename Lane, bool IsMin>                                                                 \
+            __attribute__((target(TARGET))) Lane extremumKernel(const Lane* data, size_t size)                  \
+            {                                                                                                   \
+                using O = Ops<Lane>;                                                                            \
+                if (size < 2 * O::width) {                                                                      \
+                    return IsMin ? minScalar(data, size) : maxScalar(data, size);                               \
+                }                                                                                               \
+                                                                                                                \
+                auto best = O::load(data);                                                                      \
+                unsigned hasNaN = O::unorderedMask(best);                                                       \
+                size_t i = O::width;                                                                            \
+                                                                                                                \
+                for (; i + O::width <= size; i += O::width)                                                     \
+                {                                                                                               \
+                    const auto current = O::load(data + i);                                                     \
+                    best = IsMin ? O::min(current, best) : O::max(current, best);                               \
+                    hasNaN |= O::unorderedMask(current);                                                        \
+                }                                                                                               \
+                                                                                                                \
+                if (hasNaN != 0) {                                                                              \
+                    return IsMin ? minScalar(data, size) : maxScalar(data, size);                               \
+                }                                                                                               \
+                                                                                                                \
+                /* Свожу дорожки регистра и оставшийся хвост массива скалярно. */                               \
+                alignas(64) Lane lanes[O::width + 1];                                                           \
+                O::store(lanes, best);                                                                          \
+                Lane result = IsMin ? minScalar(lanes, O::width) : maxScalar(lanes, O::width);                  \
+                                                                                                                \
+                for (; i < size; ++i) {                                                                         \
+                    if (IsMin ? (data[i] < result) : (result < data[i])) result = data[i];                      \
+                }                                                                                               \
+                                                                                                                \
+                return result;                                                                                  \
+            }
+
+
+        /* === SSE2 (128-битные регистры): === */
+        namespace Sse2
+        {
+            #define CONTAINERS_SSE2 static inline __attribute__((target("sse2"), always_inline))
+
+            // Выбор одного из значений по маске (SSE2 не имеет инструкций blend): mask ? b : a.
+            CONTAINERS_SSE2 __m128i select(__m128i mask, __m128i a, __m128i b) {
+                return _mm_or_si128(_mm_and_si128(mask, b), _mm_andnot_si128(mask, a));
+            }
+
+            /* Количество единичных битов в маске (не более 4 бит). Инструкция popcnt в базовом x86-64 не гарантирована,
+               а программная реализация __builtin_popcount слишком медленна для внутреннего цикла - использую таблицу. */
+            CONTAINERS_SSE2 unsigned maskPopcount(unsigned mask)
+            {
+                static constexpr unsigned char bits[16] = { 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 };
+                return bits[mask & 15u];
+            }
+
+            template<typename Lane> struct Ops;
+
+            template<typename Lane>
+            struct Ops32
+            {
+                static constexpr size_t width = 4;
+
+                CONTAINERS_SSE2 __m128i  load(const Lane* p)           { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+                CONTAINERS_SSE2 void     store(Lane* p, __m128i v)     { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+                CONTAINERS_SSE2 __m128i  broadcast(Lane v)             { return _mm_set1_epi32(static_cast<int>(v)); }
+                CONTAINERS_SSE2 unsigned equalMask(__m128i a, __m128i b) { return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b))); }
+                CONTAINERS_SSE2 unsigned unorderedMask(__m128i)        { return 0; }
+
+                // Беззнаковое сравнение сводится к знаковому инверсией старшего бита.
+                CONTAINERS_SSE2 __m128i greater(__m128i a, __m128i b)
+                {
+                    if (std::is_signed<Lane>::value) { return _mm_cmpgt_epi32(a, b); }
+                    const __m128i bias = _mm_set1_epi32(INT32_MIN);
+                    return _mm_cmpgt_epi32(_mm_xor_si128(a, bias), _mm_xor_si128(b, bias));
+                }
+
+                CONTAINERS_SSE2 __m128i min(__m128i a, __m128i b) { return select(greater(b, a), b, a); }
+                CONTAINERS_SSE2 __m128i max(__m128i a, __m128i b) { return select(greater(a, b), b, a); }
+            };
+
+            template<typename Lane>
+            struct Ops64
+            {
+                static constexpr size_t width = 2;
+                static constexpr bool   hasMinMax = false;   // В SSE2 нет сравнения 64-битных целых "больше".
+
+                CONTAINERS_SSE2 __m128i  load(const Lane* p)           { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+                CONTAINERS_SSE2 __m128i  broadcast(Lane v)             { return _mm_set1_epi64x(static_cast<long long>(v)); }
+
+                // 64-битное равенство: обе 32-битные половины должны совпасть.
+                CONTAINERS_SSE2 unsigned equalMask(__m128i a, __m128i b)
+                {
+                    const __m128i halves = _mm_cmpeq_epi32(a, b);
+                    const __m128i both = _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+                    return _mm_movemask_pd(_mm_castsi128_pd(both));
+                }
+            };
+
+            template<> struct Ops<int32_t>  : Ops32<int32_t>  { static constexpr bool hasMinMax = true; };
+            template<> struct Ops<uint32_t> : Ops32<uint32_t> { static constexpr bool hasMinMax = true; };
+            template<> struct Ops<int64_t>  : Ops64<int64_t>  {};
+            template<> struct Ops<uint64_t> : Ops64<uint64_t> {};
+
+            template<> struct Ops<float>
+            {
+                static constexpr size_t width = 4;
+                static constexpr bool   hasMinMax = true;
+
+                CONTAINERS_SSE2 __m128   load(const float* p)          { return _mm_loadu_ps(p); }
+                CONTAINERS_SSE2 void     store(float* p, __m128 v)     { _mm_storeu_ps(p, v); }
+                CONTAINERS_SSE2 __m128   broadcast(float v)            { return _mm_set1_ps(v); }
+                CONTAINERS_SSE2 unsigned equalMask(__m128 a, __m128 b) { return _mm_movemask_ps(_mm_cmpeq_ps(a, b)); }
+                CONTAINERS_SSE2 unsigned unorderedMask(__m128 a)       { return _mm_movemask_ps(_mm_cmpunord_ps(a, a)); }
+                CONTAINERS_SSE2 __m128   min(__m128 a, __m128 b)       { return _mm_min_ps(a, b); }
+                CONTAINERS_SSE2 __m128   max(__m128 a, __m128 b)       { return _mm_max_ps(a, b); }
+            };
+
+            template<> struct Ops<double>
+            {
+                static constexpr size_t width = 2;
+                static constexpr bool   hasMinMax = true;
+
+                CONTAINERS_SSE2 __m128d  load(const double* p)           { return _mm_loadu_pd(p); }
+                CONTAINERS_SSE2 void     store(double* p, __m128d v)     { _mm_storeu_pd(p, v); }
+                CONTAINERS_SSE2 __m128d  broadcast(double v)             { return _mm_set1_pd(v); }
+                CONTAINERS_SSE2 unsigned equalMask(__m128d a, __m128d b) { return _mm_movemask_pd(_mm_cmpeq_pd(a, b)); }
+                CONTAINERS_SSE2 unsigned unorderedMask(__m128d a)        { return _mm_movemask_pd(_mm_cmpunord_pd(a, a)); }
+                CONTAINERS_SSE2 __m128d  min(__m128d a, __m128d b)       { return _mm_min_pd(a, b); }
+                CONTAINERS_SSE2 __m128d  max(__m128d a, __m128d b)       { return _mm_max_pd(a, b); }
+            };
+
+            #undef CONTAINERS_SSE2
+
+            CONTAINERS_SIMD_DEFINE_KERNELS("sse2")
+
+        } // namespace Sse2.
+
+
+        /* === AVX2 (256-битные регистры): === */
+        namespace Avx2
+        {
+            #define CONTAINERS_AVX2 static inline __attribute__((target("avx2,popcnt"), always_inline))
+
+            // Все процессоры с AVX2 поддерживают инструкцию popcnt.
+            CONTAINERS_AVX2 unsigned maskPopcount(unsigned mask) { return __builtin_popcount(mask); }
+
+            template<typename Lane> struct Ops;
+
+            template<typename Lane>
+            struct OpsInt
+            {
+                static constexpr size_t width = 32 / sizeof(Lane);
+                static constexpr bool   hasMinMax = true;
+
+                CONTAINERS_AVX2 __m256i load(const Lane* p)       { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+                CONTAINERS_AVX2 void    store(Lane* p, __m256i v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+                CONTAINERS_AVX2 unsigned unorderedMask(__m256i)   { return 0; }
+            };
+
+            template<> struct Ops<int32_t> : OpsInt<int32_t>
+            {
+                CONTAINERS_AVX2 __m256i  broadcast(int32_t v)            { return _mm256_set1_epi32(v); }
+                CONTAINERS_AVX2 unsigned equalMask(__m256i a, __m256i b) { return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b))); }
+                CONTAINERS_AVX2 __m256i  min(__m256i a, __m256i b)       { return _mm256_min_epi32(a, b); }
+                CONTAINERS_AVX2 __m256i  max(__m256i a, __m256i b)       { return _mm256_max_epi32(a, b); }
+            };
+
+            template<> struct Ops<uint32_t> : OpsInt<uint32_t>
+            {
+                CONTAINERS_AVX2 __m256i  broadcast(uint32_t v)           { return _mm256_set1_epi32(static_cast<int>(v)); }
+                CONTAINERS_AVX2 unsigned equalMask(__m256i a, __m256i b) { return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b))); }
+                CONTAINERS_AVX2 __m256i  min(__m256i a, __m256i b)       { return _mm256_min_epu32(a, b); }
+                CONTAINERS_AVX2 __m256i  max(__m256i a, __m256i b)       { return _mm256_max_epu32(a, b); }
+            };
+
+            template<typename Lane>
+            struct Ops64 : OpsInt<Lane>
+            {
+                CONTAINERS_AVX2 __m256i  broadcast(Lane v)               { return _mm256_set1_epi64x(static_cast<long long>(v)); }
+                CONTAINERS_AVX2 unsigned equalMask(__m256i a, __m256i b) { return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(a, b))); }
+
+                // Беззнаковое сравнение сводится к знаковому инверсией старшего бита.
+                CONTAINERS_AVX2 __m256i greater(__m256i a, __m256i b)
+                {
+                    if (std::is_signed<Lane>::value) { return _mm256_cmpgt_epi64(a, b); }
+                    const __m256i bias = _mm256_set1_epi64x(INT64_MIN);
+                    return _mm256_cmpgt_epi64(_mm256_xor_si256(a, bias), _mm256_xor_si256(b, bias));
+                }
+
+                CONTAINERS_AVX2 __m256i min(__m256i a, __m256i b) { return _mm256_blendv_epi8(a, b, greater(a, b)); }
+                CONTAINERS_AVX2 __m256i max(__m256i a, __m256i b) { return _mm256_blendv_epi8(a, b, greater(b, a)); }
+            };
+
+            template<> struct Ops<int64_t>  : Ops64<int64_t>  {};
+            template<> struct Ops<uint64_t> : Ops64<uint64_t> {};
+
+            template<> struct Ops<float>
+            {
+                static constexpr size_t width = 8;
+                static constexpr bool   hasMinMax = true;
+
+                CONTAINERS_AVX2 __m256   load(const float* p)          { return _mm256_loadu_ps(p); }
+                CONTAINERS_AVX2 void     store(float* p, __m256 v)     { _mm256_storeu_ps(p, v); }
+                CONTAINERS_AVX2 __m256   broadcast(float v)            { return _mm256_set1_ps(v); }
+                CONTAINERS_AVX2 unsigned equalMask(__m256 a, __m256 b) { return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)); }
+                CONTAINERS_AVX2 unsigned unorderedMask(__m256 a)       { return _mm256_movemask_ps(_mm256_cmp_ps(a, a, _CMP_UNORD_Q)); }
+                CONTAINERS_AVX2 __m256   min(__m256 a, __m256 b)       { return _mm256_min_ps(a, b); }
+                CONTAINERS_AVX2 __m256   max(__m256 a, __m256 b)       { return _mm256_max_ps(a, b); }
+            };
+
+            template<> struct Ops<double>
+            {
+                static constexpr size_t width = 4;
+                static constexpr bool   hasMinMax = true;
+
+                CONTAINERS_AVX2 __m256d  load(const double* p)           { return _mm256_loadu_pd(p); }
+                CONTAINERS_AVX2 void     store(double* p, __m256d v)     { _mm256_storeu_pd(p, v); }
+                CONTAINERS_AVX2 __m256d  broadcast(double v)             { return _mm256_set1_pd(v); }
+                CONTAINERS_AVX2 unsigned equalMask(__m256d a, __m256d b) { return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ)); }
+                CONTAINERS_AVX2 unsigned unorderedMask(__m256d a)        { return _mm256_movemask_pd(_mm256_cmp_pd(a, a, _CMP_UNORD_Q)); }
+                CONTAINERS_AVX2 __m256d  min(__m256d a, __m256d b)       { return _mm256_min_pd(a, b); }
+                CONTAINERS_AVX2 __m256d  max(__m256d a, __m256d b)       { return _mm256_max_pd(a, b); }
+            };
+
+            #undef CONTAINERS_AVX2
+
+            CONTAINERS_SIMD_DEFINE_KERNELS("avx2,popcnt")
+
+        } // namespace Avx2.
+
+
+        /* === AVX-512 (512-битные регистры, маски сравнения - отдельные регистры k): === */
+
+        // Подавляю ложное предупреждение GCC 12 о неинициализированной переменной внутри <avx512fintrin.h>.
+        #if defined(__GNUC__) && !defined(__clang__)
+            #pragma GCC diagnostic push
+            #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+        #endif
+
+        namespace Avx512
+        {
+            #define CONTAINERS_AVX512 static inline __attribute__((target("avx512f,popcnt"), always_inline))
+
+            // Все процессоры с AVX-512 поддерживают инструкцию popcnt.
+            CONTAINERS_AVX512 unsigned maskPopcount(unsigned mask) { return __builtin_popcount(mask); }
+
+            template<typename Lane> struct Ops;
+
+            template<typename Lane>
+            struct OpsInt
+            {
+                static constexpr size_t width = 64 / sizeof(Lane);
+                static constexpr bool   hasMinMax = true;
+
+                CONTAINERS_AVX512 __m512i  load(const Lane* p)       { return _mm512_loadu_si512(p); }
+                CONTAINERS_AVX512 void     store(Lane* p, __m512i v) { _mm512_storeu_si512(p, v); }
+                CONTAINERS_AVX512 unsigned unorderedMask(__m512i)    { return 0; }
+            };
+
+            template<> struct Ops<int32_t> : OpsInt<int32_t>
+            {
+                CONTAINERS_AVX512 __m512i  broadcast(int32_t v)            { return _mm512_set1_epi32(v); }
+                CONTAINERS_AVX512 unsigned equalMask(__m512i a, __m512i b) { return _mm512_cmpeq_epi32_mask(a, b); }
+                CONTAINERS_AVX512 __m512i  min(__m512i a, __m512i b)       { return _mm512_min_epi32(a, b); }
+                CONTAINERS_AVX512 __m512i  max(__m512i a, __m512i b)       { return _mm512_max_epi32(a, b); }
+            };
+
+            template<> struct Ops<uint32_t> : OpsInt<uint32_t>
+            {
+                CONTAINERS_AVX512 __m512i  broadcast(uint32_t v)           { return _mm512_set1_epi32(static_cast<int>(v)); }
+                CONTAINERS_AVX512 unsigned equalMask(__m512i a, __m512i b) { return _mm512_cmpeq_epi32_mask(a, b); }
+                CONTAINERS_AVX512 __m512i  min(__m512i a, __m512i b)       { return _mm512_min_epu32(a, b); }
+                CONTAINERS_AVX512 __m512i  max(__m512i a, __m512i b)       { return _mm512_max_epu32(a, b); }
+            };
+
+            template<> struct Ops<int64_t> : OpsInt<int64_t>
+            {
+                CONTAINERS_AVX512 __m512i  broadcast(int64_t v)            { return _mm512_set1_epi64(v); }
+                CONTAINERS_AVX512 unsigned equalMask(__m512i a, __m512i b) { return _mm512_cmpeq_epi64_mask(a, b); }
+                CONTAINERS_AVX512 __m512i  min(__m512i a, __m512i b)       { return _mm512_min_epi64(a, b); }
+                CONTAINERS_AVX512 __m512i  max(__m512i a, __m512i b)       { return _mm512_max_epi64(a, b); }
+            };
+
+            template<> struct Ops<uint64_t> : OpsInt<uint64_t>
+            {
+                CONTAINERS_AVX512 __m512i  broadcast(uint64_t v)           { return _mm512_set1_epi64(static_cast<long long>(v)); }
+                CONTAINERS_AVX512 unsigned equalMask(__m512i a, __m512i b) { return _mm512_cmpeq_epi64_mask(a, b); }
+                CONTAINERS_AVX512 __m512i  min(__m512i a, __m512i b)       { return _mm512_min_epu64(a, b); }
+                CONTAINERS_AVX512 __m512i  max(__m512i a, __m512i b)       { return _mm512_max_epu64(a, b); }
+            };
+
+            template<> struct Ops<float>
+            {
+                static constexpr size_t width = 16;
+                static constexpr bool   hasMinMax = true;
+
+                CONTAINERS_AVX512 __m512   load(const float* p)          { return _mm512_loadu_ps(p); }
+                CONTAINERS_AVX512 void     store(float* p, __m512 v)     { _mm512_storeu_ps(p, v); }
+                CONTAINERS_AVX512 __m512   broadcast(float v)            { return _mm512_set1_ps(v); }
+                CONTAINERS_AVX512 unsigned equalMask(__m512 a, __m512 b) { return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ); }
+                CONTAINERS_AVX512 unsigned unorderedMask(__m512 a)       { return _mm512_cmp_ps_mask(a, a, _CMP_UNORD_Q); }
+                CONTAINERS_AVX512 __m512   min(__m512 a, __m512 b)       { return _mm512_min_ps(a, b); }
+                CONTAINERS_AVX512 __m512   max(__m512 a, __m512 b)       { return _mm512_max_ps(a, b); }
+            };
+
+            template<> struct Ops<double>
+            {
+                static constexpr size_t width = 8;
+                static constexpr bool   hasMinMax = true;
+
+                CONTAINERS_AVX512 __m512d  load(const double* p)           { return _mm512_loadu_pd(p); }
+                CONTAINERS_AVX512 void     store(double* p, __m512d v)     { _mm512_storeu_pd(p, v); }
+                CONTAINERS_AVX512 __m512d  broadcast(double v)             { return _mm512_set1_pd(v); }
+                CONTAINERS_AVX512 unsigned equalMask(__m512d a, __m512d b) { return _mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ); }
+                CONTAINERS_AVX512 unsigned unorderedMask(__m512d a)        { return _mm512_cmp_pd_mask(a, a, _CMP_UNORD_Q); }
+                CONTAINERS_AVX512 __m512d  min(__m512d a, __m512d b)       { return _mm512_min_pd(a, b); }
+                CONTAINERS_AVX512 __m512d  max(__m512d a, __m512d b)       { return _mm512_max_pd(a, b); }
+            };
+
+            #undef CONTAINERS_AVX512
+
+            CONTAINERS_SIMD_DEFINE_KERNELS("avx512f,popcnt")
+
+        } // namespace Avx512.
+
+        #if defined(__GNUC__) && !defined(__clang__)
+            #pragma GCC diagnostic pop
+        #endif
+
+        #undef CONTAINERS_SIMD_DEFINE_KERNELS
+
+    #endif // CONTAINERS_SIMD_X86
+
+
+        /* === Ядра с выбором реализации во время выполнения: === */
+        template<typename T>
+        size_t find(const T* data, size_t size, const T& value)
+        {
+            using Lane = typename LaneType<T>::type;
+
+            if constexpr (!std::is_void<Lane>::value)
+            {
+            #if CONTAINERS_SIMD_X86
+                const Lane* lanes = reinterpret_cast<const Lane*>(data);
+
+                switch (activeLevel())
+                {
+                    case Level::AVX512: return Avx512::findKernel<Lane>(lanes, size, static_cast<Lane>(value));
+                    case Level::AVX2:   return Avx2::findKernel<Lane>(lanes, size, static_cast<Lane>(value));
+                    case Level::SSE2:   return Sse2::findKernel<Lane>(lanes, size, static_cast<Lane>(value));
+                    default: break;
+                }
+            #endif
+            }
+
+            return findScalar(data, size, value);
+        }
+
+        template<typename T>
+        size_t count(const T* data, size_t size, const T& value)
+        {
+            using Lane = typename LaneType<T>::type;
+
+            if constexpr (!std::is_void<Lane>::value)
+            {
+            #if CONTAINERS_SIMD_X86
+                const Lane* lanes = reinterpret_cast<const Lane*>(data);
+
+                switch (activeLevel())
+                {
+                    case Level::AVX512: return Avx512::countKernel<Lane>(lanes, size, static_cast<Lane>(value));
+                    case Level::AVX2:   return Avx2::countKernel<Lane>(lanes, size, static_cast<Lane>(value));
+                    case Level::SSE2:   return Sse2::countKernel<Lane>(lanes, size, static_cast<Lane>(value));
+                    default: break;
+                }
+            #endif
+            }
+
+            return countScalar(data, size, value);
+        }
+
+        // Общая часть min / max: выбор ядра по уровню (для SSE2 и 64-битных целых - скалярный цикл).
+        template<typename T, bool IsMin>
+        T extremum(const T* data, size_t size)
+        {
+            using Lane = typename LaneType<T>::type;
+
+            if constexpr (!std::is_void<Lane>::value)
+            {
+            #if CONTAINERS_SIMD_X86
+                const Lane* lanes = reinterpret_cast<const Lane*>(data);
+
+                switch (activeLevel())
+                {
+                    case Level::AVX512: return static_cast<T>(Avx512::extremumKernel<Lane, IsMin>(lanes, size));
+                    case Level::AVX2:   return static_cast<T>(Avx2::extremumKernel<Lane, IsMin>(lanes, size));
+                    case Level::SSE2:
+                        if constexpr (Sse2::Ops<Lane>::hasMinMax) {
+                            return static_cast<T>(Sse2::extremumKernel<Lane, IsMin>(lanes, size));
+                        }
+                        break;
+                    default: break;
+                }
+            #endif
+            }
+
+            return IsMin ? minScalar(data, size) : maxScalar(data, size);
+        }
+
+        template<typename T> T min(const T* data, size_t size) { return extremum<T, true>(data, size);  }
+        template<typename T> T max(const T* data, size_t size) { return extremum<T, false>(data, size); }
+
+    } // namespace Simd.
+
+} // namespace Containers.
\ No newline at end of file
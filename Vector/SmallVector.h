@@ -0,0 +1,119 @@
+#pragma once
+#include "Vector.h"
+
+// Пространство имен Containers предназначено для хранения различных контейнеров.
+namespace Containers
+{
+    /* SmallVector - шаблонный класс вектора со встроенным буфером на N элементов.
+       Пока элементов не больше N, они хранятся прямо внутри объекта (без обращения к куче),
+       а при превышении - переезжают в динамическую память, как у обычного Vector.
+       Класс наследует интерфейс и итератор Vector, поэтому может использоваться вместо него. */
+    template<typename T, size_t N>
+    class SmallVector;
+
+
+    /* SmallVectorStorage - встроенный буфер SmallVector. Вынесен в отдельный базовый класс, стоящий перед Vector<T>:
+       базовые классы создаются по порядку, поэтому к моменту вызова конструктора Vector<T> буфер уже существует. */
+    template<typename T, size_t N>
+    class SmallVectorStorage
+    {
+    private:
+        friend class SmallVector<T, N>;
+
+        alignas(T) unsigned char inlineBuffer[N * sizeof(T)];
+
+        T* inlineData() { return reinterpret_cast<T*>(inlineBuffer); } // Указатель на буфер как на массив элементов.
+    };
+
+
+    template<typename T, size_t N>
+    class SmallVector : private SmallVectorStorage<T, N>, public Vector<T>
+    {
+        static_assert(N > 0, "Error! SmallVector requires a non-empty inline buffer.");
+
+    public:
+        /* === Конструкторы и деструктор: === */
+        SmallVector();                                      // Конструктор по умолчанию (без выделения памяти).
+        SmallVector(const std::initializer_list<T>& values); // Конструктор из списка инициализации.
+
+        SmallVector(const SmallVector& other);              // Конструктор копирования.
+        SmallVector(const Vector<T>& other);                // Конструктор копирования из обычного вектора.
+        SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible<T>::value); // Конструктор перемещения.
+        SmallVector(Vector<T>&& other);                     // Конструктор перемещения из обычного вектора (может выделять память).
+
+        ~SmallVector();                                     // Деструктор.
+
+
+        /* === Перегруженные операторы: === */
+        SmallVector& operator=(const SmallVector& other);   // Оператор присваивания копированием.
+        SmallVector& operator=(SmallVector&& other) noexcept(std::is_nothrow_move_constructible<T>::value); // Присваивание перемещением.
+
+
+        /* === Методы для получения информации о векторе: === */
+        using Vector<T>::usesInlineBuffer;                  // Находятся ли элементы во встроенном буфере.
+    };
+
+} // namespace Containers.
+
+
+
+/* ... ОПРЕДЕЛЕНИЕ ФУНКЦИОНАЛЬНОСТИ КЛАССА ... */
+namespace Containers
+{
+
+    /* === Конструкторы и деструктор: === */
+    template<typename T, size_t N>
+    SmallVector<T, N>::SmallVector() : SmallVectorStorage<T, N>(), Vector<T>(this->inlineData(), N) {}
+
+    template<typename T, size_t N>
+    SmallVector<T, N>::SmallVector(const std::initializer_list<T>& values) : SmallVector() {
+        this->pushBack(values);
+    }
+
+    template<typename T, size_t N>
+    SmallVector<T, N>::SmallVector(const SmallVector& other) : SmallVector() {
+        this->append(other.begin(), other.end());
+    }
+
+    template<typename T, size_t N>
+    SmallVector<T, N>::SmallVector(const Vector<T>& other) : SmallVector() {
+        this->append(other.begin(), other.end());
+    }
+
+    /* Перемещение SmallVector той же ёмкости N не выделяет памяти: элементы из встроенного буфера other помещаются
+       во встроенный буфер этого вектора, а динамический буфер забирается целиком (ресурс памяти у обоих - куча).
+       Элементы встроенного буфера переносятся конструктором перемещения T, поэтому noexcept - только вместе с ним. */
+    template<typename T, size_t N>
+    SmallVector<T, N>::SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible<T>::value) : SmallVector() {
+        Vector<T>::operator=(std::move(other));
+    }
+
+    template<typename T, size_t N>
+    SmallVector<T, N>::SmallVector(Vector<T>&& other) : SmallVector() {
+        Vector<T>::operator=(std::move(other));
+    }
+
+    template<typename T, size_t N>
+    SmallVector<T, N>::~SmallVector()
+    {
+        // Уничтожаю элементы, пока встроенный буфер ещё жив; динамическую память (если есть) освободит ~Vector.
+        this->clear();
+    }
+
+
+    /* === Перегруженные операторы: === */
+    template<typename T, size_t N>
+    SmallVector<T, N>& SmallVector<T, N>::operator=(const SmallVector& other)
+    {
+        Vector<T>::operator=(other);
+        return *this;
+    }
+
+    template<typename T, size_t N>
+    SmallVector<T, N>& SmallVector<T, N>::operator=(SmallVector&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+    {
+        Vector<T>::operator=(std::move(other));
+        return *this;
+    }
+
+} // namespace Containers.
\ No newline at end of file
@@ -0,0 +1,395 @@
+#pragma once
+#include <tuple>
+#include <utility>
+#include "Vector.h"
+
+// Пространство имен Containers предназначено для хранения различных контейнеров.
+namespace Containers
+{
+    /* ColumnSpan - непрерывный участок памяти с элементами одного столбца (указатель + длина).
+       Предназначен для передачи столбца в векторизованные ядра и стандартные алгоритмы. */
+    template<typename T>
+    struct ColumnSpan
+    {
+        T*     pointer;                                 // Первый элемент столбца.
+        size_t length;                                  // Количество элементов.
+
+        T*     data()  const { return pointer; }
+        size_t size()  const { return length;  }
+        T*     begin() const { return pointer; }
+        T*     end()   const { return pointer + length; }
+
+        T& operator[](size_t index) const { return pointer[index]; }
+    };
+
+
+    /* SoAVector - вектор записей, хранящий каждое поле в отдельном столбце (structure of arrays).
+       Если проход по данным читает одно-два поля, из памяти загружаются только нужные столбцы,
+       а не записи целиком, и циклы по столбцу векторизуются. Каждый столбец - обычный Vector,
+       поэтому рост ёмкости и итератор устроены так же; доступ к строке - через прокси-ссылку Row
+       (ConstRow - для константного вектора). Присваивание и swap строк работают по полям,
+       поэтому строки можно сортировать стандартными алгоритмами (std::sort, std::iter_swap). */
+    template<typename... Fields>
+    class SoAVector
+    {
+        static_assert(sizeof...(Fields) > 0, "Error! SoAVector requires at least one field.");
+
+    public:
+        /* === Типы полей и строк: === */
+        template<size_t I>
+        using FieldType = std::tuple_element_t<I, std::tuple<Fields...>>;   // Тип I-го поля.
+        using Record    = std::tuple<Fields...>;                            // Запись целиком (значение).
+
+        class Row;                                      // Прокси-ссылка на строку.
+        class ConstRow;                                 // Прокси-ссылка на строку только для чтения.
+
+    private:
+        template<typename RowType, typename Owner>
+        class RowIterator;                              // Итератор по строкам (общий для изменяемого и константного).
+
+    public:
+        using Iterator      = RowIterator<Row, SoAVector>;              // Итератор по строкам.
+        using ConstIterator = RowIterator<ConstRow, const SoAVector>;   // Итератор по строкам только для чтения.
+
+
+    private:
+        /* === Данные вектора: === */
+        std::tuple<Vector<Fields>...> columns;          // Столбцы (все одинаковой длины).
+
+        static constexpr std::index_sequence_for<Fields...> fieldIndices{};
+
+
+        /* === Вспомогательные методы: === */
+        template<size_t... I>
+        void pushRow(std::index_sequence<I...>, const Fields&... values);   // Добавление строки в конец каждого столбца.
+
+        template<size_t... I>
+        Record takeRow(size_t index, std::index_sequence<I...>) const;      // Копирование строки в запись.
+
+
+    public:
+        /* === Методы для получения итераторов на начало и конец вектора: === */
+        Iterator      begin();
+        Iterator      end();
+        ConstIterator begin() const;
+        ConstIterator end()   const;
+
+
+        /* === Конструкторы: === */
+        SoAVector();                                    // Конструктор по умолчанию.
+        SoAVector(int inputCapacity);                   // Конструктор с заданной ёмкостью (для каждого столбца).
+
+
+        /* === Методы для добавления и удаления строк: === */
+        void   pushBack(const Fields&... values);       // Добавление строки в конец вектора.
+        void   pushBack(const Record& record);          // Добавление записи в конец вектора.
+        Record popBack();                               // Удаление последней строки из вектора.
+        void   erase(size_t index);                     // Удаление строки по индексу.
+        void   clear();                                 // Удаление всех строк (ёмкость сохраняется).
+
+
+        /* === Методы для управления размером и ёмкостью вектора: === */
+        void reserve(size_t newCapacity);               // Увеличение ёмкости до заданной (не меньше).
+        void resize(size_t newSize);                    // Изменение размера (новые поля создаются по умолчанию).
+        void shrinkToFit();                             // Уменьшение ёмкости до текущего размера.
+
+
+        /* === Методы доступа к строкам и столбцам: === */
+        Row      at(size_t index);                      // Обращение к строке с проверкой границ.
+        ConstRow at(size_t index) const;                // Обращение к строке с проверкой границ (только чтение).
+        Row      operator[](size_t index);              // Обращение к строке без проверки границ.
+        ConstRow operator[](size_t index) const;        // Обращение к строке без проверки границ (только чтение).
+
+        template<size_t I>
+        ColumnSpan<FieldType<I>> column();              // Столбец I-го поля.
+
+        template<size_t I>
+        const Vector<FieldType<I>>& columnVector() const; // Столбец I-го поля как Vector (только чтение, с поиском).
+
+
+        /* === Методы для получения информации о векторе: === */
+        bool   isEmpty()  const;                        // Проверка на пустоту вектора.
+        size_t capacity() const;                        // Получение текущей ёмкости вектора.
+        size_t size()     const;                        // Получение текущего размера вектора.
+    };
+
+} // namespace Containers.
+
+
+
+/* ... ОПРЕДЕЛЕНИЕ ФУНКЦИОНАЛЬНОСТИ КЛАССА ... */
+namespace Containers
+{
+
+    /* === Описание прокси-ссылки на строку: === */
+    template<typename... Fields>
+    class SoAVector<Fields...>::Row
+    {
+    private:
+        // Вектор и индекс строки (поля строки лежат в разных столбцах).
+        SoAVector* vector;
+        size_t currIndex;
+
+        template<size_t... I>
+        void assign(const Record& record, std::index_sequence<I...>) const { ((get<I>() = std::get<I>(record)), ...); }
+
+        template<size_t... I>
+        static void swapFields(const Row& left, const Row& right, std::index_sequence<I...>)
+        {
+            using std::swap;
+            (swap(left.template get<I>(), right.template get<I>()), ...);
+        }
+
+    public:
+        Row(SoAVector* inputVector, size_t index) : vector(inputVector), currIndex(index) {}
+        Row(const Row& other) = default;
+
+        // Доступ к I-му полю строки:
+        template<size_t I>
+        FieldType<I>& get() const { return std::get<I>(vector->columns)[currIndex]; }
+
+        // Копирование строки в запись и присваивание строке значения записи:
+        operator Record() const { return vector->takeRow(currIndex, fieldIndices); }
+
+        const Row& operator=(const Record& record) const
+        {
+            assign(record, fieldIndices);
+            return *this;
+        }
+
+        /* Присваивание строки строке копирует значения полей, а не перенаправляет прокси (как у ссылки).
+           Строка сначала копируется в запись - источник может совпадать с приёмником. */
+        const Row& operator=(const Row& other) const
+        {
+            assign(Record(other), fieldIndices);
+            return *this;
+        }
+
+        // Обмен значениями полей двух строк (в том числе временных прокси, которые возвращает итератор).
+        friend void swap(const Row& left, const Row& right) { swapFields(left, right, fieldIndices); }
+
+        // Строка только для чтения:
+        operator ConstRow() const { return ConstRow(vector, currIndex); }
+
+        size_t index() const { return currIndex; }
+    };
+
+
+    /* === Описание прокси-ссылки на строку только для чтения: === */
+    template<typename... Fields>
+    class SoAVector<Fields...>::ConstRow
+    {
+    private:
+        // Вектор и индекс строки.
+        const SoAVector* vector;
+        size_t currIndex;
+
+    public:
+        ConstRow(const SoAVector* inputVector, size_t index) : vector(inputVector), currIndex(index) {}
+
+        // Доступ к I-му полю строки (только чтение):
+        template<size_t I>
+        const FieldType<I>& get() const { return *(std::get<I>(vector->columns).begin() + currIndex); }
+
+        // Копирование строки в запись:
+        operator Record() const { return vector->takeRow(currIndex, fieldIndices); }
+
+        size_t index() const { return currIndex; }
+    };
+
+
+    /* === Описание структуры итератора: === */
+    template<typename... Fields>
+    template<typename RowType, typename Owner>
+    class SoAVector<Fields...>::RowIterator
+    {
+    private:
+        // Вектор и индекс текущей строки.
+        Owner* vector;
+        size_t currIndex;
+
+    public:
+        // Информация об итераторе для совместимости со стандартными алгоритмами:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = Record;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = void;
+        using reference         = RowType;
+
+        // Пользовательский конструктор:
+        RowIterator(Owner* inputVector, size_t index) : vector(inputVector), currIndex(index) {}
+
+        // Оператор разыменования:
+        reference operator*() const { return RowType(vector, currIndex); }
+
+        // Операторы инкрементирования и декрементирования:
+        RowIterator& operator++()    { ++currIndex; return *this; }
+        RowIterator  operator++(int) { RowIterator temp = *this; ++currIndex; return temp; }
+        RowIterator& operator--()    { --currIndex; return *this; }
+        RowIterator  operator--(int) { RowIterator temp = *this; --currIndex; return temp; }
+
+        // Арифметические операторы:
+        RowIterator  operator+(difference_type n) const { return RowIterator(vector, currIndex + n); }
+        RowIterator  operator-(difference_type n) const { return RowIterator(vector, currIndex - n); }
+
+        RowIterator& operator+=(difference_type n) { currIndex += n; return *this; }
+        RowIterator& operator-=(difference_type n) { currIndex -= n; return *this; }
+
+        difference_type operator-(const RowIterator& other) const {
+            return static_cast<difference_type>(currIndex) - static_cast<difference_type>(other.currIndex);
+        }
+
+        // Операторы сравнения:
+        bool operator==(const RowIterator& other) const { return currIndex == other.currIndex; }
+        bool operator!=(const RowIterator& other) const { return currIndex != other.currIndex; }
+        bool operator<=(const RowIterator& other) const { return currIndex <= other.currIndex; }
+        bool operator>=(const RowIterator& other) const { return currIndex >= other.currIndex; }
+        bool operator< (const RowIterator& other) const { return currIndex < other.currIndex;  }
+        bool operator> (const RowIterator& other) const { return currIndex > other.currIndex;  }
+
+        // Оператор индексирования:
+        reference operator[](difference_type n) const { return RowType(vector, currIndex + n); }
+    };
+
+
+    /* === Вспомогательные защищенные методы: === */
+    template<typename... Fields>
+    template<size_t... I>
+    void SoAVector<Fields...>::pushRow(std::index_sequence<I...>, const Fields&... values)
+    {
+        // Значения могут ссылаться на строку этого же вектора - сначала копирую запись целиком.
+        Record record(values...);
+        size_t pushed = 0;
+
+        try { ((std::get<I>(columns).pushBack(std::move(std::get<I>(record))), ++pushed), ...); }
+        catch (...)
+        {
+            // Если добавление в один из столбцов не удалось - убираю уже добавленные поля, чтобы длины совпадали.
+            ((I < pushed ? (void)std::get<I>(columns).popBack() : (void)0), ...);
+            throw;
+        }
+    }
+
+    template<typename... Fields>
+    template<size_t... I>
+    typename SoAVector<Fields...>::Record SoAVector<Fields...>::takeRow(size_t index, std::index_sequence<I...>) const {
+        return Record(*(std::get<I>(columns).begin() + index)...);
+    }
+
+
+    /* === Публичные методы для получения итераторов на начало и конец вектора: === */
+    template<typename... Fields> typename SoAVector<Fields...>::Iterator SoAVector<Fields...>::begin() { return Iterator(this, 0); }
+    template<typename... Fields> typename SoAVector<Fields...>::Iterator SoAVector<Fields...>::end()   { return Iterator(this, size()); }
+
+    template<typename... Fields> typename SoAVector<Fields...>::ConstIterator SoAVector<Fields...>::begin() const { return ConstIterator(this, 0); }
+    template<typename... Fields> typename SoAVector<Fields...>::ConstIterator SoAVector<Fields...>::end()   const { return ConstIterator(this, size()); }
+
+
+    /* === Конструкторы: === */
+    template<typename... Fields>
+    SoAVector<Fields...>::SoAVector() : columns() {}
+
+    template<typename... Fields>
+    SoAVector<Fields...>::SoAVector(int inputCapacity) : columns(Vector<Fields>(inputCapacity)...) {}
+
+
+    /* === Публичные методы для добавления и удаления строк: === */
+    template<typename... Fields>
+    void SoAVector<Fields...>::pushBack(const Fields&... values) { pushRow(fieldIndices, values...); }
+
+    template<typename... Fields>
+    void SoAVector<Fields...>::pushBack(const Record& record) {
+        std::apply([this](const Fields&... values) { pushRow(fieldIndices, values...); }, record);
+    }
+
+    template<typename... Fields>
+    typename SoAVector<Fields...>::Record SoAVector<Fields...>::popBack()
+    {
+        if (this->isEmpty()) {
+            throw std::runtime_error("Error! You cannot delete an element from an empty vector.");
+        }
+
+        return std::apply([](Vector<Fields>&... column) { return Record(column.popBack()...); }, columns);
+    }
+
+    template<typename... Fields>
+    void SoAVector<Fields...>::erase(size_t index)
+    {
+        if (index >= size()) {
+            throw std::out_of_range("Error! Index is out of range.");
+        }
+
+        std::apply([index](Vector<Fields>&... column) { (column.erase(column.begin() + index), ...); }, columns);
+    }
+
+    template<typename... Fields>
+    void SoAVector<Fields...>::clear() {
+        std::apply([](Vector<Fields>&... column) { (column.clear(), ...); }, columns);
+    }
+
+
+    /* === Публичные методы для управления размером и ёмкостью вектора: === */
+    template<typename... Fields>
+    void SoAVector<Fields...>::reserve(size_t newCapacity) {
+        std::apply([newCapacity](Vector<Fields>&... column) { (column.reserve(newCapacity), ...); }, columns);
+    }
+
+    template<typename... Fields>
+    void SoAVector<Fields...>::resize(size_t newSize) {
+        std::apply([newSize](Vector<Fields>&... column) { (column.resize(newSize), ...); }, columns);
+    }
+
+    template<typename... Fields>
+    void SoAVector<Fields...>::shrinkToFit() {
+        std::apply([](Vector<Fields>&... column) { (column.shrinkToFit(), ...); }, columns);
+    }
+
+
+    /* === Публичные методы доступа к строкам и столбцам: === */
+    template<typename... Fields>
+    typename SoAVector<Fields...>::Row SoAVector<Fields...>::at(size_t index)
+    {
+        if (index >= size()) {
+            throw std::out_of_range("Error! Index is out of range.");
+        }
+
+        return Row(this, index);
+    }
+
+    template<typename... Fields>
+    typename SoAVector<Fields...>::ConstRow SoAVector<Fields...>::at(size_t index) const
+    {
+        if (index >= size()) {
+            throw std::out_of_range("Error! Index is out of range.");
+        }
+
+        return ConstRow(this, index);
+    }
+
+    template<typename... Fields>
+    typename SoAVector<Fields...>::Row SoAVector<Fields...>::operator[](size_t index) { return Row(this, index); }
+
+    template<typename... Fields>
+    typename SoAVector<Fields...>::ConstRow SoAVector<Fields...>::operator[](size_t index) const { return ConstRow(this, index); }
+
+    template<typename... Fields>
+    template<size_t I>
+    ColumnSpan<typename SoAVector<Fields...>::template FieldType<I>> SoAVector<Fields...>::column()
+    {
+        Vector<FieldType<I>>& currColumn = std::get<I>(columns);
+        return ColumnSpan<FieldType<I>>{ &*currColumn.begin(), currColumn.size() };
+    }
+
+    template<typename... Fields>
+    template<size_t I>
+    const Vector<typename SoAVector<Fields...>::template FieldType<I>>& SoAVector<Fields...>::columnVector() const {
+        return std::get<I>(columns);
+    }
+
+
+    /* === Публичные методы для получения информации о векторе: === */
+    template<typename... Fields> bool   SoAVector<Fields...>::isEmpty()  const { return std::get<0>(columns).isEmpty();  }
+    template<typename... Fields> size_t SoAVector<Fields...>::capacity() const { return std::get<0>(columns).capacity(); }
+    template<typename... Fields> size_t SoAVector<Fields...>::size()     const { return std::get<0>(columns).size();     }
+
+} // namespace Containers.
\ No newline at end of file
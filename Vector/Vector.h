@@ -1,9 +1,35 @@
 #pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <iterator>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "Concatenation.h"
+#include "GrowthPolicy.h"
+#include "SimdSearch.h"
 
 // Пространство имен Containers предназначено для хранения различных контейнеров.
 namespace Containers 
 {
+    /* IsTriviallyRelocatable - признак типа, объекты которого можно переносить в другую память
+       побайтовым копированием (без вызова конструктора перемещения и деструктора старого объекта).
+       По умолчанию признак выставлен для тривиально копируемых типов; для остальных типов пользователь
+       может включить его явной специализацией (например, для типов, владеющих указателем на кучу). */
+    template<typename T>
+    struct IsTriviallyRelocatable : std::is_trivially_copyable<T> {};
+
+
+    // SmallVector - вектор со встроенным буфером (SmallVector.h); Vector перемещает его отдельным конструктором.
+    template<typename T, size_t N>
+    class SmallVector;
+
+
     // Vector - шаблонный класс, являющийся оберткой над динамическим массивом.
     template<typename T>
     class Vector 
@@ -14,9 +40,55 @@ namespace Containers
         size_t currSize     = 0;      // Текущий размер вектора (количество элементов).
         size_t currCapacity = 10;     // Текущая ёмкость вектора (максимальное количество элементов без перевыделения памяти).
 
+        T*     inlineObjects  = nullptr; // Указатель на встроенный буфер наследника (SmallVector), иначе nullptr.
+        size_t inlineCapacity = 0;       // Ёмкость встроенного буфера.
+
+        std::pmr::memory_resource* resource = nullptr; // Источник памяти для элементов (nullptr - обычная куча).
+
+        GrowthRule   growth;          // Правило роста ёмкости (вид стратегии и её параметр).
+
+#if CONTAINERS_VECTOR_STATS
+        VectorStats  statistics;      // Статистика перевыделений этого вектора.
+#endif
+
 
-        /* === Вспомогательный метод для выделения памяти: === */
-        void allocateMemory();        // Выделение памяти необходимого размера для хранения элементов.
+        /* === Свойства типа элементов, определяющие выбор быстрых путей на этапе компиляции: === */
+        static constexpr bool isTriviallyCopyable    = std::is_trivially_copyable<T>::value;
+        static constexpr bool isTriviallyRelocatable = IsTriviallyRelocatable<T>::value 
+                                                    && alignof(T) <= alignof(std::max_align_t);
+        static constexpr bool isOverAligned          = alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+
+        /* === Вспомогательные методы для управления памятью: === */
+        T*   allocateBlock(size_t capacity);          // Выделение блока "сырой" памяти (в куче или у ресурса памяти).
+        void freeBlock(T* block, size_t capacity);    // Освобождение блока памяти заданной ёмкости.
+        bool sharesResourceWith(const Vector& other) const; // Совместима ли память двух векторов (можно ли забрать буфер).
+
+        void allocateMemory();                        // Выделение "сырой" памяти необходимого размера (без создания элементов).
+        void deallocateMemory();                      // Уничтожение всех элементов и освобождение памяти.
+        void reallocateMemory(size_t newCapacity);    // Перенос элементов в новую память заданной ёмкости.
+        void ensureCapacity(size_t requiredCapacity); // Рост ёмкости (по стратегии роста) до требуемой за одно перевыделение.
+
+
+        /* === Вспомогательные методы для работы с элементами в "сырой" памяти: === */
+        template<typename ForwardIt>
+        static void copyConstruct(ForwardIt first, size_t count, T* destination); // Копирование диапазона в неинициализированную память.
+        static void relocate(T* source, T* destination, size_t count);           // Перенос элементов (диапазоны могут перекрываться).
+        static void destroyRange(T* first, size_t count);                        // Уничтожение элементов диапазона.
+
+        template<typename ForwardIt>
+        void copyToEnd(ForwardIt first, size_t count);  // Копирование диапазона в конец (ёмкость должна быть достаточной).
+        T*   openGap(size_t index, size_t count);       // Сдвиг хвоста вправо, возвращает указатель на освободившееся место.
+        void closeGap(size_t index, size_t count);      // Возврат хвоста на место после неудачного заполнения промежутка.
+
+
+    protected:
+        /* === Поддержка встроенного буфера для наследников (SmallVector): === */
+        Vector(T* inlineBuffer, size_t inlineBufferCapacity) noexcept; // Конструктор поверх встроенного буфера.
+        bool usesInlineBuffer() const;                                 // Находятся ли элементы во встроенном буфере.
+
+        void stealBuffer(Vector& other) noexcept;     // Забрать буфер other (он не встроенный и из совместимого ресурса).
+        void relocateFrom(Vector& other);             // Перенести элементы other по одному в свою память.
 
 
     public:
@@ -32,27 +104,54 @@ namespace Containers
         /* === Конструкторы и деструктор: === */
         Vector();                                       // Конструктор по умолчанию.
         Vector(int inputCapacity);                      // Конструктор с заданной ёмкостью.
+
+        explicit Vector(std::pmr::memory_resource* memoryResource);        // Конструктор с заданным ресурсом памяти.
+        explicit Vector(const GrowthPolicy& growthPolicy);                 // Конструктор с заданной стратегией роста.
+        Vector(int inputCapacity, std::pmr::memory_resource* memoryResource); // Конструктор с ёмкостью и ресурсом памяти.
         Vector(const std::initializer_list<T>& values); // Конструктор из списка инициализации.
 
-        Vector(Vector&& other) noexcept;                // Конструктор перемещения.
+        Vector(Vector&& other) noexcept;                // Конструктор перемещения (только забирает буфер).
+        template<size_t N>
+        Vector(SmallVector<T, N>&& other);              // Перемещение из SmallVector (может выделять память).
         Vector(const Vector& other);                    // Конструктор копирования.
 
         ~Vector();                                      // Деструктор.
 
 
-        /* === Перегруженные операторы: === */
-        Vector  operator+ (const Vector& other) const;  // Оператор сложения двух векторов.
+        /* === Перегруженные операторы (сложение векторов a + b - ленивое выражение, см. Concatenation.h): === */
         Vector& operator+=(const Vector& other);        // Оператор составного присваивания.
         Vector& operator= (const Vector& other);        // Оператор присваивания копированием.
-        Vector& operator= (Vector&& other) noexcept;    // Оператор присваивания перемещением.
+        Vector& operator= (Vector&& other);             // Оператор присваивания перемещением (см. примечание у определения).
         bool    operator<<(const T& value) const;       // Оператор проверки наличия элемента в векторе.
 
 
         /* === Методы для добавления и удаления элементов: === */
-        void pushBack(T value);                         // Добавление элемента в конец вектора.
+        void pushBack(const T& value);                  // Добавление копии элемента в конец вектора.
+        void pushBack(T&& value);                       // Добавление элемента в конец вектора перемещением.
         void pushBack(const std::initializer_list<T>&); // Добавление диапазона элементов в конец вектора.
+
+        template<typename... Args>
+        T&   emplaceBack(Args&&... args);               // Создание элемента на месте в конце вектора.
         T    popBack();                                 // Удаление последнего элемента из вектора.
 
+        template<typename InputIt>
+        void append(InputIt first, InputIt last);       // Добавление диапазона элементов в конец вектора.
+
+        Iterator insert(Iterator pos, const T& value);  // Вставка элемента перед позицией pos.
+        template<typename InputIt>
+        Iterator insert(Iterator pos, InputIt first, InputIt last); // Вставка диапазона элементов перед позицией pos.
+
+        Iterator erase(Iterator pos);                   // Удаление элемента в позиции pos.
+        Iterator erase(Iterator first, Iterator last);  // Удаление диапазона элементов [first, last).
+        void     clear();                               // Удаление всех элементов (ёмкость сохраняется).
+
+
+        /* === Методы для управления размером и ёмкостью вектора: === */
+        void reserve(size_t newCapacity);               // Увеличение ёмкости до заданной (не меньше).
+        void resize(size_t newSize);                    // Изменение размера (новые элементы создаются по умолчанию).
+        void resize(size_t newSize, const T& value);    // Изменение размера (новые элементы - копии value).
+        void shrinkToFit();                             // Уменьшение ёмкости до текущего размера.
+
 
         /* === Методы доступа к элементам вектора: === */
         T& at(size_t index);                            // Обращение к элементу с проверкой границ.
@@ -61,12 +160,33 @@ namespace Containers
         T  back()  const;                               // Получение последнего элемента вектора.
 
 
+        /* === Методы для поиска элементов в векторе (векторизованы для арифметических типов): === */
+        T*             find(const T& value) const;      // Указатель на первый элемент со значением value (nullptr, если не найден).
+        std::ptrdiff_t indexOf(const T& value) const;   // Индекс первого элемента со значением value (-1, если не найден).
+        size_t         count(const T& value) const;     // Количество элементов со значением value.
+        T              minElement() const;              // Получение минимального элемента вектора.
+        T              maxElement() const;              // Получение максимального элемента вектора.
+
+
         /* === Методы для получения информации о векторе: === */
         bool   isEmpty()  const;                        // Проверка на пустоту вектора.
         size_t capacity() const;                        // Получение текущей ёмкости вектора.
         size_t size()     const;                        // Получение текущего размера вектора.
+
+        std::pmr::memory_resource* memoryResource() const; // Получение ресурса памяти (nullptr - обычная куча).
+
+
+        /* === Методы для настройки роста и получения статистики перевыделений: === */
+        void                setGrowthPolicy(const GrowthPolicy& growthPolicy); // Замена стратегии роста ёмкости.
+        GrowthPolicy        growthPolicy() const;       // Текущая стратегия роста ёмкости (начальная ёмкость не хранится).
+        const VectorStats&  stats() const;              // Статистика перевыделений (нули без CONTAINERS_VECTOR_STATS; общая - VectorTelemetry::global()).
     };
 
+    /* Обычный Vector (не SmallVector) не хранит указателей на самого себя, поэтому его можно переносить побайтово.
+       Благодаря этому вектор векторов растёт одним realloc, без вызова конструктора перемещения. */
+    template<typename T>
+    struct IsTriviallyRelocatable<Vector<T>> : std::true_type {};
+
 } // namespace Containers.
 
 
@@ -75,10 +195,287 @@ namespace Containers
 namespace Containers 
 {
 
-    /* === Вспомогательный защищенный метод для выделения памяти: === */
+    /* === Вспомогательные защищенные методы для управления памятью: === */
     template<typename T> 
-    void Vector<T>::allocateMemory() {
-        objects = new T[currCapacity];
+    T* Vector<T>::allocateBlock(size_t capacity)
+    {
+        // Если задан ресурс памяти (например, арена) - память выделяется только через него.
+        if (resource != nullptr) {
+            return static_cast<T*>(resource->allocate(capacity * sizeof(T), alignof(T)));
+        }
+
+        // Память под тривиально переносимые элементы беру через malloc, чтобы при росте использовать realloc.
+        if constexpr (isTriviallyRelocatable) 
+        {
+            T* block = static_cast<T*>(std::malloc(capacity * sizeof(T) + (capacity == 0)));
+            if (block == nullptr) { throw std::bad_alloc(); }
+            return block;
+        }
+        else if constexpr (isOverAligned) {
+            // Обычный operator new гарантирует лишь __STDCPP_DEFAULT_NEW_ALIGNMENT__ - для сверхвыровненных типов прошу выравнивание явно.
+            return static_cast<T*>(::operator new(capacity * sizeof(T), std::align_val_t(alignof(T))));
+        }
+        else {
+            return static_cast<T*>(::operator new(capacity * sizeof(T)));
+        }
+    }
+
+    template<typename T> 
+    void Vector<T>::freeBlock(T* block, size_t capacity)
+    {
+        if (block == nullptr) { return; }
+
+        if (resource != nullptr) {
+            resource->deallocate(block, capacity * sizeof(T), alignof(T));
+        }
+        else if constexpr (isTriviallyRelocatable) { std::free(block); }
+        else if constexpr (isOverAligned)          { ::operator delete(block, std::align_val_t(alignof(T))); }
+        else                                       { ::operator delete(block); }
+    }
+
+    template<typename T> 
+    bool Vector<T>::sharesResourceWith(const Vector& other) const
+    {
+        if (resource == nullptr || other.resource == nullptr) { return resource == other.resource; }
+        return resource->is_equal(*other.resource);
+    }
+
+    template<typename T> 
+    void Vector<T>::allocateMemory() 
+    {
+        /* Выделяю неинициализированную память: элементы будут создаваться в ней
+           по мере добавления (placement new), а не все сразу до значения ёмкости. */
+        objects = allocateBlock(currCapacity);
+
+#if CONTAINERS_VECTOR_STATS
+        VectorTelemetry::observe(statistics, currCapacity, sizeof(T));
+#endif
+    }
+
+    template<typename T> 
+    void Vector<T>::deallocateMemory()
+    {
+        // Вызываю деструкторы только для реально созданных элементов.
+        if constexpr (!std::is_trivially_destructible<T>::value) {
+            for (size_t i = 0; i < currSize; ++i) { objects[i].~T(); }
+        }
+
+        // Встроенный буфер SmallVector принадлежит самому объекту - освобождать его не нужно.
+        if (!usesInlineBuffer()) { freeBlock(objects, currCapacity); }
+
+        objects = inlineObjects;
+    }
+
+    template<typename T> 
+    void Vector<T>::reallocateMemory(size_t newCapacity)
+    {
+        // Если новая ёмкость помещается во встроенный буфер (SmallVector) - элементы переезжают в него.
+        const bool toInline = inlineObjects != nullptr && newCapacity <= inlineCapacity;
+
+        if (toInline) 
+        {
+            newCapacity = inlineCapacity;
+            if (usesInlineBuffer()) { return; }
+        }
+
+        /* Быстрый путь: тривиально переносимые элементы переезжают вместе с блоком памяти.
+           realloc по возможности расширяет блок на месте, иначе сам копирует байты (memcpy). */
+        if constexpr (isTriviallyRelocatable)
+        {
+            T* newMemory = nullptr;
+            size_t movedBytes = currSize * sizeof(T);
+
+            // realloc применим только к памяти из обычной кучи.
+            if (!toInline && !usesInlineBuffer() && resource == nullptr)
+            {
+                newMemory = static_cast<T*>(std::realloc(static_cast<void*>(objects), newCapacity * sizeof(T) + (newCapacity == 0)));
+                if (newMemory == nullptr) { throw std::bad_alloc(); }
+                if (newMemory == objects) { movedBytes = 0; }   // Блок расширен на месте - ничего не копировалось.
+            }
+            else
+            {
+                // Переезд между встроенным буфером, кучей и ресурсом памяти - побайтовое копирование.
+                newMemory = toInline ? inlineObjects : allocateBlock(newCapacity);
+                if (currSize != 0) { std::memcpy(static_cast<void*>(newMemory), static_cast<const void*>(objects), currSize * sizeof(T)); }
+                if (!usesInlineBuffer()) { freeBlock(objects, currCapacity); }
+            }
+
+            objects = newMemory;
+            currCapacity = newCapacity;
+
+#if CONTAINERS_VECTOR_STATS
+            VectorTelemetry::record(statistics, newCapacity, sizeof(T), movedBytes);
+#endif
+            return;
+        }
+
+        T* newMemory = toInline ? inlineObjects : allocateBlock(newCapacity);
+        size_t moved = 0;
+
+        try 
+        {
+            /* Переношу элементы в новую память. Если конструктор перемещения типа T не бросает
+               исключений - элементы перемещаются, иначе копируются (строгая гарантия безопасности). */
+            for (; moved < currSize; ++moved) {
+                new (newMemory + moved) T(std::move_if_noexcept(objects[moved]));
+            }
+        }
+        catch (...)
+        {
+            // Откатываю частично выполненный перенос, старый буфер остаётся нетронутым.
+            for (size_t i = 0; i < moved; ++i) { newMemory[i].~T(); }
+            if (!toInline) { freeBlock(newMemory, newCapacity); }
+            throw;
+        }
+
+        // Уничтожаю старые элементы (после перемещения) и освобождаю старую память.
+        deallocateMemory();
+
+        objects = newMemory;
+        currCapacity = newCapacity;
+
+#if CONTAINERS_VECTOR_STATS
+        VectorTelemetry::record(statistics, newCapacity, sizeof(T), moved * sizeof(T));
+#endif
+    }
+
+    template<typename T> 
+    void Vector<T>::ensureCapacity(size_t requiredCapacity)
+    {
+        if (requiredCapacity > currCapacity) {
+            reallocateMemory(growth.nextCapacity(currCapacity, requiredCapacity, sizeof(T)));
+        }
+    }
+
+    template<typename T> 
+    template<typename ForwardIt>
+    void Vector<T>::copyConstruct(ForwardIt first, size_t count, T* destination)
+    {
+        // Если диапазон задан указателями или итераторами вектора - он непрерывен в памяти.
+        constexpr bool isContiguous = std::is_same<ForwardIt, T*>::value 
+                                   || std::is_same<ForwardIt, const T*>::value
+                                   || std::is_same<ForwardIt, Iterator>::value;
+
+        // Тривиально копируемые элементы из непрерывного диапазона копирую одним блоком.
+        if constexpr (isTriviallyCopyable && isContiguous)
+        {
+            if (count != 0) { std::memcpy(static_cast<void*>(destination), &*first, count * sizeof(T)); }
+        }
+        else
+        {
+            size_t constructed = 0;
+
+            try {
+                for (; constructed < count; ++constructed, ++first) {
+                    new (destination + constructed) T(*first);
+                }
+            }
+            catch (...)
+            {
+                // Уничтожаю уже созданные копии, чтобы в памяти не осталось "полуготового" диапазона.
+                for (size_t i = 0; i < constructed; ++i) { destination[i].~T(); }
+                throw;
+            }
+        }
+    }
+
+    /* Если конструктор перемещения T выбросит исключение, relocate уничтожает все ещё живые элементы диапазона
+       (и уже перенесённые, и оставшиеся на старом месте): после исключения в обоих диапазонах нет живых объектов,
+       и вызывающий метод лишь исключает их из размера вектора (базовая гарантия безопасности). */
+    template<typename T> 
+    void Vector<T>::relocate(T* source, T* destination, size_t count)
+    {
+        if (count == 0 || source == destination) { return; }
+
+        // Тривиально переносимые элементы сдвигаю одним блоком (memmove корректно работает с перекрытием).
+        if constexpr (isTriviallyRelocatable) {
+            std::memmove(static_cast<void*>(destination), static_cast<const void*>(source), count * sizeof(T));
+        }
+        else
+        {
+            // Направление обхода выбираю так, чтобы не затереть ещё не перенесённые элементы.
+            if (destination < source)
+            {
+                size_t i = 0;
+
+                try {
+                    for (; i < count; ++i) 
+                    {
+                        new (destination + i) T(std::move(source[i]));
+                        source[i].~T();
+                    }
+                }
+                catch (...)
+                {
+                    // Живы перенесённые [0, i) на новом месте и неперенесённые [i, count) на старом - места не пересекаются.
+                    destroyRange(destination, i);
+                    destroyRange(source + i, count - i);
+                    throw;
+                }
+            }
+            else
+            {
+                size_t i = count;
+
+                try {
+                    for (; i > 0; --i) 
+                    {
+                        new (destination + i - 1) T(std::move(source[i - 1]));
+                        source[i - 1].~T();
+                    }
+                }
+                catch (...)
+                {
+                    destroyRange(source, i);
+                    destroyRange(destination + i, count - i);
+                    throw;
+                }
+            }
+        }
+    }
+
+    template<typename T> 
+    void Vector<T>::destroyRange(T* first, size_t count)
+    {
+        if constexpr (!std::is_trivially_destructible<T>::value) {
+            for (size_t i = 0; i < count; ++i) { first[i].~T(); }
+        }
+    }
+
+    template<typename T> 
+    template<typename ForwardIt>
+    void Vector<T>::copyToEnd(ForwardIt first, size_t count)
+    {
+        copyConstruct(first, count, objects + currSize);
+        currSize += count;
+    }
+
+    template<typename T> 
+    T* Vector<T>::openGap(size_t index, size_t count)
+    {
+        ensureCapacity(currSize + count);
+
+        // Сдвигаю хвост [index, currSize) вправо на count позиций, место под новые элементы остаётся "сырым".
+        try { relocate(objects + index, objects + index + count, currSize - index); }
+        catch (...)
+        {
+            // Хвост уничтожен переносом - в векторе остаются только элементы до index.
+            currSize = index;
+            throw;
+        }
+
+        return objects + index;
+    }
+
+    template<typename T> 
+    void Vector<T>::closeGap(size_t index, size_t count)
+    {
+        try { relocate(objects + index + count, objects + index, currSize - index); }
+        catch (...)
+        {
+            currSize = index;
+            throw;
+        }
     }
 
 
@@ -155,52 +552,93 @@ namespace Containers
     template<typename T>
     Vector<T>::Vector(int inputCapacity) : currCapacity(inputCapacity) { this->allocateMemory(); }
 
+    template<typename T>
+    Vector<T>::Vector(std::pmr::memory_resource* memoryResource) : resource(memoryResource) { this->allocateMemory(); }
+
+    template<typename T>
+    Vector<T>::Vector(const GrowthPolicy& growthPolicy) 
+        : currCapacity(growthPolicy.initialCapacity), growth(growthPolicy) { this->allocateMemory(); }
+
+    template<typename T>
+    Vector<T>::Vector(int inputCapacity, std::pmr::memory_resource* memoryResource) 
+        : currCapacity(inputCapacity), resource(memoryResource) { this->allocateMemory(); }
+
     template<typename T>
     Vector<T>::Vector(const std::initializer_list<T>& values) : Vector(values.size() * 2)
     {
         // ^^^ Увеличиваю емкость вектора, чтобы избежать частых перераспределений памяти ^^^ .
-        for (const T& currValue: values) { this->pushBack(currValue); }
+        this->copyToEnd(values.begin(), values.size());
     }
 
+    /* Перемещение только забирает буфер other и не выделяет памяти, поэтому объявлено noexcept: контейнеры
+       и структуры, хранящие Vector, растут перемещением, а не копированием (std::move_if_noexcept).
+       SmallVector перемещается в Vector отдельным конструктором - его элементы могут лежать во встроенном буфере,
+       который забрать нельзя. Важно! Не перемещайте SmallVector через ссылку Vector<T>&& - тогда будет выбран этот конструктор. */
     template<typename T>
-    Vector<T>::Vector(Vector&& other) noexcept(true)
+    Vector<T>::Vector(Vector&& other) noexcept
+        : objects(nullptr), currCapacity(0), resource(other.resource), growth(other.growth)
     {
-        // Переношу ресурсы из другого объекта в текущий.
-        this->objects = other.objects;
-        this->currSize = other.currSize; 
-        this->currCapacity = other.currCapacity;
+#if CONTAINERS_VECTOR_STATS
+        this->statistics = other.statistics;
+#endif
 
-        // Очищаю данные другого объекта, чтобы избежать двойного освобождения памяти.
-        other.objects = nullptr;
-        other.currSize = 0; other.currCapacity = 0;
+        stealBuffer(other);
     }
 
     template<typename T>
-    Vector<T>::Vector(const Vector& other) : Vector(other.currCapacity) {
-        for (const T& currValue : other) { this->pushBack(currValue); }
+    template<size_t N>
+    Vector<T>::Vector(SmallVector<T, N>&& other) : objects(nullptr), currCapacity(0)
+    {
+        Vector& source = other;
+
+        this->growth = source.growth;
+
+        // Динамический буфер SmallVector (ресурс памяти у него - куча) забираю целиком.
+        if (!source.usesInlineBuffer())
+        {
+            stealBuffer(source);
+            return;
+        }
+
+        // Элементы из встроенного буфера переношу по одному в свою память (ровно по размеру).
+        this->objects = allocateBlock(source.currSize);
+        this->currCapacity = source.currSize;
+
+        try { relocateFrom(source); }
+        catch (...)
+        {
+            // Деструктор не будет вызван - освобождаю уже выделенную память.
+            deallocateMemory();
+            throw;
+        }
     }
 
     template<typename T>
-    Vector<T>::~Vector() { delete[] objects; }
+    Vector<T>::Vector(T* inlineBuffer, size_t inlineBufferCapacity) noexcept(true)
+        : objects(inlineBuffer), currCapacity(inlineBufferCapacity), 
+          inlineObjects(inlineBuffer), inlineCapacity(inlineBufferCapacity) {}
 
-
-    /* === Перегруженные операторы === */
     template<typename T>
-    Vector<T> Vector<T>::operator+(const Vector& other) const
+    Vector<T>::Vector(const Vector& other) : Vector(other.currCapacity) 
     {
-        // Создаю временный вектор с суммарной емкостью.
-        Vector tempObject(this->currSize + other.currSize);
+        // Копия растёт так же, как оригинал; статистика у неё своя.
+        this->growth = other.growth;
+        this->copyToEnd(other.objects, other.currSize);
+    }
 
-        // Копирую элементы из обоих векторов в новый.
-        for (const T& value: *this) { tempObject.pushBack(value); }
-        for (const T& value: other) { tempObject.pushBack(value); }
+    template<typename T>
+    Vector<T>::~Vector() { deallocateMemory(); }
 
-        return tempObject;
-    }
 
+    /* === Перегруженные операторы === */
     template<typename T>
-    Vector<T>& Vector<T>::operator+=(const Vector& other) {
-        for (const T& value: other) { this->pushBack(value); }
+    Vector<T>& Vector<T>::operator+=(const Vector& other) 
+    {
+        // Если места не хватает - увеличиваю ёмкость один раз (по стратегии роста), а не по мере добавления.
+        ensureCapacity(this->currSize + other.currSize);
+
+        // Указатель other.objects беру после перевыделения (случай v += v).
+        this->copyToEnd(other.objects, other.currSize);
         return *this;
     }
 
@@ -210,90 +648,81 @@ namespace Containers
         // Осуществляю проверку на самоприсваивание, чтобы избежать возможных ошибок.
         if (this != &other) 
         {
-            // Освобождаю память, занятую текущими элементами.
-            delete[] objects;
-
-            // Сбрасываю размер вектора и устанавливаю новую емкость из другого вектора.
-            this->currSize = 0;
-            this->currCapacity = other.currCapacity;
-
-            // Выделяю новую память под элементы с учетом обновленной емкости.
-            allocateMemory();
+            // Уничтожаю текущие элементы; память перевыделяю, только если её не хватает.
+            this->clear();
+            this->reserve(other.currSize);
 
-            // Копирую элементы из другого вектора в текущий с помощью метода pushBack.
-            for (const T& value : other) { 
-                this->pushBack(value); 
-            }
+            // Копирую элементы из другого вектора в текущий.
+            this->copyToEnd(other.objects, other.currSize);
         }
 
         return *this;
     }
 
+    /* Присваивание перемещением выделяет память, только если буфер other из несовместимого ресурса памяти
+       (или other - SmallVector с элементами во встроенном буфере, а ёмкости этого вектора не хватает),
+       поэтому оно не объявлено noexcept. */
     template<typename T>
-    Vector<T>& Vector<T>::operator=(Vector&& other) noexcept(true)
+    Vector<T>& Vector<T>::operator=(Vector&& other)
     {
         // Осуществляю проверку на самоприсваивание, чтобы избежать ненужных операций и возможных ошибок.
         if (this != &other)
         {
-            // Освобождаю память, занятую текущими элементами.
-            delete[] objects;
-
-            // Переношу ресурсы из другого объекта в текущий.
-            this->objects = other.objects;
-            this->currSize = other.currSize; 
-            this->currCapacity = other.currCapacity;
-
-            // Очищаю данные другого объекта, чтобы избежать двойного освобождения памяти.
-            other.objects = nullptr;
-            other.currSize = 0; other.currCapacity = 0;
+            /* Элементы из встроенного буфера SmallVector, как и буфер из несовместимого
+               ресурса памяти, забрать нельзя - переношу элементы по одному. */
+            if (other.usesInlineBuffer() || !sharesResourceWith(other)) {
+                relocateFrom(other);
+            }
+            else {
+                stealBuffer(other);
+            }
         }
 
         return *this;
     }
 
     template<typename T>
-    bool Vector<T>::operator<<(const T& value) const
-    {
-        for (const T& currValue: *this) {
-            if (currValue == value) return true;
-        }
-
-        return false;
+    bool Vector<T>::operator<<(const T& value) const {
+        return this->indexOf(value) != -1;
     }
 
 
     /* === Публичные методы для добавления и удаления элементов из вектора: === */
     template<typename T>
-    void Vector<T>::pushBack(T value)
+    template<typename... Args>
+    T& Vector<T>::emplaceBack(Args&&... args)
     {
-        // Если я начинаю превышать емкость:
+        // Если я начинаю превышать емкость - увеличиваю её по стратегии роста и переношу элементы в новую память.
         if (currSize >= currCapacity)
         {
-            // Увеличиваю емкость в 2 раза и выделяю новую память.
-            currCapacity *= 2;
-            T* newMemory = new T[currCapacity];
-
-            // Копирую существующие элементы в новый массив.
-            for (size_t i = 0; i < currSize; ++i) {
-                newMemory[i] = objects[i];
-            }
+            /* Аргументы могут ссылаться на элемент этого же вектора, который переедет при перевыделении,
+               поэтому сначала создаю новый элемент, а уже затем увеличиваю ёмкость. */
+            T temp(std::forward<Args>(args)...);
+            ensureCapacity(currSize + 1);
 
-            // Освобождаю старую память и переназначаю указатель.
-            delete[] objects;
-            objects = newMemory;
+            new (objects + currSize) T(std::move(temp));
+        }
+        else {
+            // Создаю новый элемент прямо в конце (в неинициализированной памяти), без промежуточных копий.
+            new (objects + currSize) T(std::forward<Args>(args)...);
         }
 
-        // Добавляю новый элемент в конец и увеличиваю размер вектора.
-        objects[currSize] = value;
         ++currSize;
+        return objects[currSize - 1];
     }
 
+    template<typename T>
+    void Vector<T>::pushBack(const T& value) { this->emplaceBack(value); }
+
+    template<typename T>
+    void Vector<T>::pushBack(T&& value) { this->emplaceBack(std::move(value)); }
+
     template<typename T>
     void Vector<T>::pushBack(const std::initializer_list<T>& values)
     {
-        for (const T& currValue: values) {
-            this->pushBack(currValue);
-        }
+        // Если места не хватает - увеличиваю ёмкость один раз, а не по мере добавления.
+        ensureCapacity(currSize + values.size());
+        this->copyToEnd(values.begin(), values.size());
     }
 
     template<typename T>
@@ -304,17 +733,176 @@ namespace Containers
             throw std::runtime_error("Error! You cannot delete an element from an empty vector.");
         }
 
-        // Уменьшаю размер вектора и сохраняю удаляемый элемент.
+        // Уменьшаю размер вектора и забираю удаляемый элемент.
         --currSize;
-        T temp = objects[currSize];
+        T temp = std::move(objects[currSize]);
 
-        // Вызываю деструктор для удаленного элемента (необязательно, если тип T - примитивный).
+        // Вызываю деструктор для удаленного элемента, так как память под него остаётся выделенной.
         objects[currSize].~T();
 
         return temp;
     }
 
 
+    template<typename T>
+    template<typename InputIt>
+    void Vector<T>::append(InputIt first, InputIt last)
+    {
+        using Category = typename std::iterator_traits<InputIt>::iterator_category;
+
+        /* Для однопроходных итераторов размер диапазона заранее неизвестен - добавляю поэлементно.
+           Важно! Диапазон не должен принадлежать этому же вектору (он может переехать при росте ёмкости). */
+        if constexpr (!std::is_base_of<std::forward_iterator_tag, Category>::value) {
+            for (; first != last; ++first) { this->emplaceBack(*first); }
+        }
+        else
+        {
+            // Вычисляю итоговый размер один раз и увеличиваю ёмкость не более одного раза.
+            const size_t count = static_cast<size_t>(std::distance(first, last));
+
+            ensureCapacity(currSize + count);
+            this->copyToEnd(first, count);
+        }
+    }
+
+    template<typename T>
+    typename Vector<T>::Iterator Vector<T>::insert(Iterator pos, const T& value)
+    {
+        // Значение может ссылаться на элемент этого же вектора, поэтому сначала делаю его копию.
+        T temp(value);
+        const size_t index = static_cast<size_t>(pos - begin());
+
+        T* gap = openGap(index, 1);
+
+        try { new (gap) T(std::move(temp)); }
+        catch (...)
+        {
+            // Если элемент не удалось создать - возвращаю хвост на место.
+            closeGap(index, 1);
+            throw;
+        }
+
+        ++currSize;
+
+        return begin() + index;
+    }
+
+    template<typename T>
+    template<typename InputIt>
+    typename Vector<T>::Iterator Vector<T>::insert(Iterator pos, InputIt first, InputIt last)
+    {
+        using Category = typename std::iterator_traits<InputIt>::iterator_category;
+        const size_t index = static_cast<size_t>(pos - begin());
+
+        // Однопроходный диапазон сначала собираю во временный вектор, чтобы узнать его размер.
+        if constexpr (!std::is_base_of<std::forward_iterator_tag, Category>::value)
+        {
+            Vector buffer;
+            buffer.append(first, last);
+
+            return insert(begin() + index, buffer.begin(), buffer.end());
+        }
+        else
+        {
+            // Важно! Диапазон не должен принадлежать этому же вектору.
+            const size_t count = static_cast<size_t>(std::distance(first, last));
+            T* gap = openGap(index, count);
+
+            try { copyConstruct(first, count, gap); }
+            catch (...)
+            {
+                // Если копирование не удалось - возвращаю хвост на место.
+                closeGap(index, count);
+                throw;
+            }
+
+            currSize += count;
+            return begin() + index;
+        }
+    }
+
+    template<typename T>
+    typename Vector<T>::Iterator Vector<T>::erase(Iterator pos) {
+        return erase(pos, pos + 1);
+    }
+
+    template<typename T>
+    typename Vector<T>::Iterator Vector<T>::erase(Iterator first, Iterator last)
+    {
+        const size_t index = static_cast<size_t>(first - begin());
+        const size_t count = static_cast<size_t>(last - first);
+
+        // Уничтожаю удаляемые элементы и сдвигаю хвост влево одним переносом.
+        destroyRange(objects + index, count);
+
+        try { relocate(objects + index + count, objects + index, currSize - index - count); }
+        catch (...)
+        {
+            // Хвост уничтожен переносом - в векторе остаются только элементы до index.
+            currSize = index;
+            throw;
+        }
+
+        currSize -= count;
+        return begin() + index;
+    }
+
+    template<typename T>
+    void Vector<T>::clear()
+    {
+        if constexpr (!std::is_trivially_destructible<T>::value) {
+            for (size_t i = 0; i < currSize; ++i) { objects[i].~T(); }
+        }
+
+        currSize = 0;
+    }
+
+
+    /* === Публичные методы для управления размером и ёмкостью вектора: === */
+    template<typename T>
+    void Vector<T>::reserve(size_t newCapacity)
+    {
+        if (newCapacity > currCapacity) {
+            reallocateMemory(newCapacity);
+        }
+    }
+
+    template<typename T>
+    void Vector<T>::resize(size_t newSize)
+    {
+        // Лишние элементы уничтожаю, недостающие - создаю по умолчанию.
+        while (currSize > newSize) { objects[--currSize].~T(); }
+
+        ensureCapacity(newSize);
+        for (; currSize < newSize; ++currSize) { new (objects + currSize) T(); }
+    }
+
+    template<typename T>
+    void Vector<T>::resize(size_t newSize, const T& value)
+    {
+        while (currSize > newSize) { objects[--currSize].~T(); }
+
+        // Значение может ссылаться на элемент этого же вектора, поэтому при росте ёмкости сначала делаю его копию.
+        if (newSize > currCapacity)
+        {
+            T temp(value);
+            ensureCapacity(newSize);
+            for (; currSize < newSize; ++currSize) { new (objects + currSize) T(temp); }
+        }
+        else {
+            for (; currSize < newSize; ++currSize) { new (objects + currSize) T(value); }
+        }
+    }
+
+    template<typename T>
+    void Vector<T>::shrinkToFit()
+    {
+        if (currCapacity > currSize) {
+            reallocateMemory(currSize);
+        }
+    }
+
+
     /* === Публичные методы доступа к элементам вектора: === */
     template<typename T>
     T& Vector<T>::at(size_t index)
@@ -354,9 +942,107 @@ namespace Containers
     }
 
 
+    /* === Публичные методы для поиска элементов в векторе: === */
+    template<typename T>
+    T* Vector<T>::find(const T& value) const
+    {
+        const std::ptrdiff_t index = this->indexOf(value);
+        return (index == -1) ? nullptr : objects + index;
+    }
+
+    template<typename T>
+    std::ptrdiff_t Vector<T>::indexOf(const T& value) const
+    {
+        // Ядро поиска возвращает размер массива, если значение не найдено.
+        const size_t index = Simd::find(objects, currSize, value);
+        return (index == currSize) ? -1 : static_cast<std::ptrdiff_t>(index);
+    }
+
+    template<typename T>
+    size_t Vector<T>::count(const T& value) const {
+        return Simd::count(objects, currSize, value);
+    }
+
+    template<typename T>
+    T Vector<T>::minElement() const
+    {
+        if (this->isEmpty()) {
+            throw std::runtime_error("Error! You cannot find the minimum element in an empty vector.");
+        }
+
+        return Simd::min(objects, currSize);
+    }
+
+    template<typename T>
+    T Vector<T>::maxElement() const
+    {
+        if (this->isEmpty()) {
+            throw std::runtime_error("Error! You cannot find the maximum element in an empty vector.");
+        }
+
+        return Simd::max(objects, currSize);
+    }
+
+
     /* === Методы для получения информации о векторе: === */
     template<typename T> bool   Vector<T>::isEmpty()  const { return currSize == 0; }
     template<typename T> size_t Vector<T>::capacity() const { return currCapacity;  }
     template<typename T> size_t Vector<T>::size()     const { return currSize;      }
 
+    template<typename T> bool Vector<T>::usesInlineBuffer() const { return inlineObjects != nullptr && objects == inlineObjects; }
+
+    template<typename T>
+    void Vector<T>::stealBuffer(Vector& other) noexcept
+    {
+        // Уничтожаю текущие элементы и освобождаю занятую ими память.
+        deallocateMemory();
+
+        // Переношу ресурсы из другого объекта в текущий.
+        this->objects = other.objects;
+        this->currSize = other.currSize; 
+        this->currCapacity = other.currCapacity;
+
+        // Очищаю данные другого объекта, чтобы избежать двойного освобождения памяти.
+        other.objects = other.inlineObjects;
+        other.currSize = 0; other.currCapacity = other.inlineCapacity;
+    }
+
+    template<typename T>
+    void Vector<T>::relocateFrom(Vector& other)
+    {
+        this->clear();
+        this->reserve(other.currSize);
+
+        try { relocate(other.objects, this->objects, other.currSize); }
+        catch (...)
+        {
+            // Элементы other уничтожены переносом - исключаю их из его размера.
+            other.currSize = 0;
+            throw;
+        }
+
+        this->currSize = other.currSize;
+        other.currSize = 0;
+    }
+
+    template<typename T> std::pmr::memory_resource* Vector<T>::memoryResource() const { return resource; }
+
+
+    /* === Публичные методы для настройки роста и получения статистики перевыделений: === */
+    template<typename T> void Vector<T>::setGrowthPolicy(const GrowthPolicy& growthPolicy) { growth = growthPolicy; }
+
+    template<typename T> GrowthPolicy Vector<T>::growthPolicy() const { return growth.policy(); }
+
+    template<typename T>
+    const VectorStats& Vector<T>::stats() const
+    {
+#if CONTAINERS_VECTOR_STATS
+        return statistics;
+#else
+        // Статистика не ведётся - возвращаю общую пустую.
+        static const VectorStats empty;
+        return empty;
+#endif
+    }
+
 } // namespace Containers.
\ No newline at end of file
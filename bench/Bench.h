@@ -0,0 +1,44 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+/* Bench - минимальные средства для замеров в программах каталога bench.
+   Каждая программа собирается отдельно, например:
+       g++ -std=c++17 -O2 -pthread bench/VectorGrowth.cpp -o vector_growth
+   Результаты зависят от машины, поэтому программы печатают время, а не проверяют пороги. */
+namespace Bench
+{
+    // Не даёт компилятору выбросить вычисление, результат которого нигде не используется.
+    template<typename T>
+    inline void keep(const T& value)
+    {
+        asm volatile("" : : "g"(&value) : "memory");
+    }
+
+    // Время выполнения function в миллисекундах (медиана из repeats запусков).
+    template<typename Function>
+    double measure(Function&& function, int repeats = 5)
+    {
+        std::vector<double> times;
+
+        for (int i = 0; i < repeats; ++i)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            function();
+            const auto finish = std::chrono::steady_clock::now();
+
+            times.push_back(std::chrono::duration<double, std::milli>(finish - start).count());
+        }
+
+        std::sort(times.begin(), times.end());
+        return times[times.size() / 2];
+    }
+
+    // Печать одной строки результата: название и время.
+    inline void report(const char* name, double milliseconds) {
+        std::printf("%-48s %10.2f ms\n", name, milliseconds);
+    }
+
+} // namespace Bench.
@@ -0,0 +1,98 @@
+/* Пропускная способность ConcurrentQueue при 1 - 32 производителях и стольких же потребителях.
+   Производители вместе добавляют одно и то же количество элементов, потребители извлекают их, пока
+   не заберут все. Для сравнения тот же обмен идёт через LinkedList под общим мьютексом.
+   На машине с меньшим числом ядер лишние потоки вытесняют друг друга - это тоже показательно. */
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Bench.h"
+#include "../LinkedList/ConcurrentQueue.h"
+#include "../LinkedList/LinkedList.h"
+
+namespace
+{
+    constexpr size_t totalElements = size_t(1) << 20;
+
+    /* Запуск threads производителей (каждый вызывает push для своей доли элементов) и threads потребителей
+       (каждый вызывает pop, пока все элементы не будут извлечены; pop возвращает false, если извлекать нечего). */
+    template<typename Push, typename Pop>
+    void runExchange(size_t threads, Push push, Pop pop)
+    {
+        std::vector<std::thread> workers;
+        std::atomic<size_t> consumed{ 0 };
+        const size_t share = totalElements / threads;
+
+        for (size_t p = 0; p < threads; ++p) {
+            workers.emplace_back([&, p]() { for (size_t i = 0; i < share; ++i) { push(p * share + i); } });
+        }
+
+        for (size_t c = 0; c < threads; ++c)
+        {
+            workers.emplace_back([&]()
+            {
+                size_t value = 0;
+
+                while (consumed.load(std::memory_order_relaxed) < share * threads)
+                {
+                    if (pop(value)) {
+                        consumed.fetch_add(1, std::memory_order_relaxed);
+                        Bench::keep(value);
+                    }
+                    else {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        for (std::thread& worker : workers) { worker.join(); }
+    }
+
+    double concurrentQueue(size_t threads)
+    {
+        return Bench::measure([&]()
+        {
+            Containers::ConcurrentQueue<size_t> queue;
+            runExchange(threads,
+                        [&](size_t value) { queue.push(value); },
+                        [&](size_t& value) { return queue.tryPop(value); });
+        }, 3);
+    }
+
+    double lockedList(size_t threads)
+    {
+        return Bench::measure([&]()
+        {
+            Containers::LinkedList<size_t> list;
+            std::mutex mutex;
+            runExchange(threads,
+                        [&](size_t value) {
+                            std::lock_guard<std::mutex> lock(mutex);
+                            list.pushBack(value);
+                        },
+                        [&](size_t& value) {
+                            std::lock_guard<std::mutex> lock(mutex);
+                            if (list.isEmpty()) { return false; }
+                            value = list.popFront();
+                            return true;
+                        });
+        }, 3);
+    }
+}
+
+int main()
+{
+    std::printf("%zu elements in total, %u hardware threads\n", totalElements, std::thread::hardware_concurrency());
+
+    for (size_t threads = 1; threads <= 32; threads *= 2)
+    {
+        std::printf("--- %zu producers + %zu consumers ---\n", threads, threads);
+
+        Bench::report("ConcurrentQueue push / tryPop", concurrentQueue(threads));
+        Bench::report("LinkedList under std::mutex",   lockedList(threads));
+    }
+
+    return 0;
+}
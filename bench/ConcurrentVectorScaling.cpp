@@ -0,0 +1,68 @@
+/* Масштабирование ConcurrentVector по числу потоков-производителей (1 - 64).
+   Все потоки вместе добавляют одно и то же количество элементов; для сравнения тот же объём
+   добавляется в Vector под общим мьютексом. На машине с меньшим числом ядер лишние потоки
+   просто вытесняют друг друга - это тоже показательно для схемы с блокировкой. */
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Bench.h"
+#include "../Vector/ConcurrentVector.h"
+
+namespace
+{
+    constexpr size_t totalElements = size_t(1) << 22;
+
+    // Запуск producers потоков, каждый из которых вызывает push для своей доли элементов.
+    template<typename Push>
+    void runProducers(size_t producers, Push push)
+    {
+        std::vector<std::thread> threads;
+        const size_t share = totalElements / producers;
+
+        for (size_t p = 0; p < producers; ++p) {
+            threads.emplace_back([&, p]() { for (size_t i = 0; i < share; ++i) { push(p * share + i); } });
+        }
+
+        for (std::thread& thread : threads) { thread.join(); }
+    }
+
+    double concurrentVector(size_t producers)
+    {
+        return Bench::measure([&]()
+        {
+            Containers::ConcurrentVector<size_t> vector;
+            runProducers(producers, [&](size_t value) { vector.pushBack(value); });
+            Bench::keep(vector.size());
+        });
+    }
+
+    double lockedVector(size_t producers)
+    {
+        return Bench::measure([&]()
+        {
+            Containers::Vector<size_t> vector;
+            std::mutex mutex;
+            runProducers(producers, [&](size_t value) {
+                std::lock_guard<std::mutex> lock(mutex);
+                vector.pushBack(value);
+            });
+            Bench::keep(vector.size());
+        });
+    }
+}
+
+int main()
+{
+    std::printf("%zu elements in total, %u hardware threads\n", totalElements, std::thread::hardware_concurrency());
+
+    for (size_t producers = 1; producers <= 64; producers *= 2)
+    {
+        std::printf("--- %zu producers ---\n", producers);
+
+        Bench::report("ConcurrentVector::pushBack",        concurrentVector(producers));
+        Bench::report("Vector::pushBack under std::mutex", lockedVector(producers));
+    }
+
+    return 0;
+}
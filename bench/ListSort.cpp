@@ -0,0 +1,70 @@
+/* Сортировка связанного списка из 10M узлов (размер можно передать первым аргументом).
+   Сравниваются последовательная сортировка слиянием LinkedList::sort, параллельная sortParallel
+   из LinkedList/ParallelSort.h и, для ориентира, std::sort тех же значений в std::vector.
+   Замеряется только сама сортировка: список каждый раз заполняется заново вне замера. */
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "Bench.h"
+#include "../LinkedList/ParallelSort.h"
+
+namespace
+{
+    constexpr int repeats = 3;
+
+    // Медиана времени sort (в миллисекундах); prepare вызывается перед каждым замером и в него не входит.
+    template<typename Prepare, typename Sort>
+    double measureSort(Prepare prepare, Sort sort)
+    {
+        std::vector<double> times;
+
+        for (int i = 0; i < repeats; ++i)
+        {
+            prepare();
+
+            const auto start = std::chrono::steady_clock::now();
+            sort();
+            const auto finish = std::chrono::steady_clock::now();
+
+            times.push_back(std::chrono::duration<double, std::milli>(finish - start).count());
+        }
+
+        std::sort(times.begin(), times.end());
+        return times[times.size() / 2];
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const size_t count = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : size_t(10000000);
+
+    std::vector<int> values(count);
+    std::mt19937 generator(42);
+
+    for (int& value : values) { value = static_cast<int>(generator()); }
+
+    std::printf("%zu random ints, %u hardware threads, %zu pool threads\n",
+                count, std::thread::hardware_concurrency(), Containers::ThreadPool::global().threadCount());
+
+    Containers::LinkedList<int> list;
+    auto fill = [&]() {
+        list.clear();
+        for (int value : values) { list.pushBack(value); }
+    };
+
+    Bench::report("LinkedList::sort",
+                  measureSort(fill, [&]() { list.sort(); Bench::keep(list.front()); }));
+
+    Bench::report("sortParallel(LinkedList)",
+                  measureSort(fill, [&]() { Containers::sortParallel(list); Bench::keep(list.front()); }));
+
+    std::vector<int> copy;
+    Bench::report("std::sort(std::vector) for reference",
+                  measureSort([&]() { copy = values; }, [&]() { std::sort(copy.begin(), copy.end()); Bench::keep(copy.front()); }));
+
+    return 0;
+}
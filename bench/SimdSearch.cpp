@@ -0,0 +1,108 @@
+/* Поиск по Vector<int> и Vector<double> со скалярным циклом и с векторными ядрами SSE2 / AVX2 / AVX-512
+   (уровни выше поддерживаемого процессором пропускаются). Размеры - от 16 до 16M элементов, поэтому по таблице
+   видно, с какого размера векторное ядро обгоняет скалярный цикл, и где всё упирается в пропускную способность памяти.
+   Искомого значения в векторе нет - operator<<, find, indexOf и count проходят его целиком.
+   В ячейках - время одного вызова в наносекундах. */
+#include <cstdint>
+#include <random>
+
+#include "Bench.h"
+#include "../Vector/Vector.h"
+
+namespace
+{
+    using Containers::Simd::Level;
+
+    constexpr size_t minSize = 16;
+    constexpr size_t maxSize = size_t(1) << 24;
+
+    // Суммарное число просматриваемых элементов в одном замере (чтобы малые размеры измерялись не одним вызовом).
+    constexpr size_t elementsPerMeasure = size_t(1) << 26;
+
+    const char* levelName(Level level)
+    {
+        switch (level)
+        {
+            case Level::SSE2:   return "SSE2";
+            case Level::AVX2:   return "AVX2";
+            case Level::AVX512: return "AVX-512";
+            default:            return "scalar";
+        }
+    }
+
+    // Время одного вызова operation (в наносекундах) на уровне level.
+    template<typename Operation>
+    double nanosecondsPerCall(Level level, size_t size, Operation operation)
+    {
+        Containers::Simd::setLevel(level);
+
+        const size_t calls = (elementsPerMeasure / size > 0) ? elementsPerMeasure / size : 1;
+        const double milliseconds = Bench::measure([&]() {
+            for (size_t i = 0; i < calls; ++i) { Bench::keep(operation()); }
+        }, 3);
+
+        return milliseconds * 1e6 / static_cast<double>(calls);
+    }
+
+    // Таблица для одной операции: строки - размеры, столбцы - уровни от скалярного до поддерживаемого.
+    template<typename T, typename Operation>
+    void table(const char* title, Operation operation)
+    {
+        const int supported = static_cast<int>(Containers::Simd::detectLevel());
+
+        std::printf("--- %s ---\n%10s", title, "size");
+        for (int level = 0; level <= supported; ++level) { std::printf("%12s", levelName(Level(level))); }
+        std::printf("\n");
+
+        std::mt19937 generator(7);
+
+        for (size_t size = minSize; size <= maxSize; size *= 4)
+        {
+            // Значения 1..1000, искомое значение 0 отсутствует.
+            Containers::Vector<T> vector;
+            for (size_t i = 0; i < size; ++i) { vector.pushBack(static_cast<T>(generator() % 1000 + 1)); }
+
+            std::printf("%10zu", size);
+            for (int level = 0; level <= supported; ++level) {
+                std::printf("%12.1f", nanosecondsPerCall(Level(level), size, [&]() { return operation(vector); }));
+            }
+            std::printf("\n");
+        }
+    }
+
+    template<typename T>
+    void run(const char* typeName)
+    {
+        char title[64];
+        const T missing = T(0);
+
+        std::snprintf(title, sizeof(title), "operator<< (%s)", typeName);
+        table<T>(title, [&](const Containers::Vector<T>& vector) { return vector << missing; });
+
+        std::snprintf(title, sizeof(title), "find (%s)", typeName);
+        table<T>(title, [&](const Containers::Vector<T>& vector) { return vector.find(missing); });
+
+        std::snprintf(title, sizeof(title), "indexOf (%s)", typeName);
+        table<T>(title, [&](const Containers::Vector<T>& vector) { return vector.indexOf(missing); });
+
+        std::snprintf(title, sizeof(title), "count (%s)", typeName);
+        table<T>(title, [&](const Containers::Vector<T>& vector) { return vector.count(T(500)); });
+
+        std::snprintf(title, sizeof(title), "minElement (%s)", typeName);
+        table<T>(title, [&](const Containers::Vector<T>& vector) { return vector.minElement(); });
+
+        std::snprintf(title, sizeof(title), "maxElement (%s)", typeName);
+        table<T>(title, [&](const Containers::Vector<T>& vector) { return vector.maxElement(); });
+    }
+}
+
+int main()
+{
+    std::printf("Highest supported level: %s\n", levelName(Containers::Simd::detectLevel()));
+
+    run<int32_t>("int32");
+    run<double>("double");
+
+    Containers::Simd::setLevel(Containers::Simd::detectLevel());
+    return 0;
+}
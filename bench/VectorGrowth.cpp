@@ -0,0 +1,81 @@
+/* Стоимость роста Vector для std::string и 256-байтной структуры.
+   Сравнивается текущий Vector (сырая память, перенос перемещением) с прежней схемой хранения:
+   new T[capacity] создаёт все ячейки до ёмкости, а при удвоении старые элементы копируются присваиванием. */
+#include <string>
+
+#include "Bench.h"
+#include "../Vector/Vector.h"
+
+namespace
+{
+    // Запись размером 256 байт с нетривиальным копированием.
+    struct Record
+    {
+        char payload[256];
+
+        Record() { payload[0] = 0; }
+        Record(int value) { payload[0] = char(value); }
+        Record(const Record& other) { std::copy(other.payload, other.payload + sizeof(payload), payload); }
+        Record& operator=(const Record& other) { std::copy(other.payload, other.payload + sizeof(payload), payload); return *this; }
+    };
+
+    static_assert(sizeof(Record) == 256, "Record must be 256 bytes.");
+
+    // Прежняя схема хранения Vector: конструирование всех ячеек и копирование при росте.
+    template<typename T>
+    class EagerArray
+    {
+    private:
+        T*     objects      = new T[10];
+        size_t currSize     = 0;
+        size_t currCapacity = 10;
+
+    public:
+        ~EagerArray() { delete[] objects; }
+
+        void pushBack(const T& value)
+        {
+            if (currSize == currCapacity)
+            {
+                T* newObjects = new T[currCapacity * 2];
+                for (size_t i = 0; i < currSize; ++i) { newObjects[i] = objects[i]; }
+
+                delete[] objects;
+                objects = newObjects;
+                currCapacity *= 2;
+            }
+
+            objects[currSize++] = value;
+        }
+
+        size_t size() const { return currSize; }
+    };
+
+    template<typename Container, typename Make>
+    double grow(size_t count, Make make)
+    {
+        return Bench::measure([&]()
+        {
+            Container container;
+            for (size_t i = 0; i < count; ++i) { container.pushBack(make(i)); }
+            Bench::keep(container.size());
+        });
+    }
+}
+
+int main()
+{
+    const auto makeString = [](size_t i) { return std::string(32, char('a' + i % 26)); };
+    const auto makeRecord = [](size_t i) { return Record(int(i)); };
+
+    for (size_t count : { size_t(1) << 10, size_t(1) << 16, size_t(1) << 20 })
+    {
+        std::printf("--- %zu elements ---\n", count);
+        Bench::report("std::string, new T[] + copy on growth", grow<EagerArray<std::string>>(count, makeString));
+        Bench::report("std::string, Containers::Vector",       grow<Containers::Vector<std::string>>(count, makeString));
+        Bench::report("Record(256 B), new T[] + copy on growth", grow<EagerArray<Record>>(count, makeRecord));
+        Bench::report("Record(256 B), Containers::Vector",       grow<Containers::Vector<Record>>(count, makeRecord));
+    }
+
+    return 0;
+}
@@ -0,0 +1,92 @@
+/* Последовательный и случайный доступ к большому Vector<uint64_t> с буфером из обычной кучи,
+   из AlignedResource (выравнивание по странице) и из HugePageResource (большие страницы 2 МиБ).
+   Размер вектора в МиБ задаётся первым аргументом (по умолчанию 256 МиБ - больше, чем покрывает TLB
+   на обычных страницах, но без многогигабайтных выделений); для настоящих проходов по гигабайтам
+   его стоит увеличить, например: ./vector_memory_resources 4096 */
+#include <cstdint>
+#include <cstdlib>
+#include <memory_resource>
+
+#include "Bench.h"
+#include "../Memory/AlignedResource.h"
+#include "../Memory/HugePageResource.h"
+#include "../Vector/Vector.h"
+
+namespace
+{
+    constexpr size_t randomReads = size_t(1) << 24;
+
+    // Вектор из count элементов, размещённый в resource (nullptr - обычная куча).
+    Containers::Vector<uint64_t> makeVector(size_t count, std::pmr::memory_resource* resource)
+    {
+        Containers::Vector<uint64_t> vector(resource);
+        vector.reserve(count);
+        vector.resize(count);
+
+        for (size_t i = 0; i < count; ++i) { vector[i] = i * 2654435761u; }
+
+        return vector;
+    }
+
+    // Сумма всех элементов по порядку.
+    double sequentialAccess(Containers::Vector<uint64_t>& vector)
+    {
+        return Bench::measure([&]()
+        {
+            uint64_t sum = 0;
+            for (size_t i = 0; i < vector.size(); ++i) { sum += vector[i]; }
+            Bench::keep(sum);
+        });
+    }
+
+    // Чтения по псевдослучайным индексам (линейный конгруэнтный генератор, без зависимости от прочитанных значений).
+    double randomAccess(Containers::Vector<uint64_t>& vector)
+    {
+        return Bench::measure([&]()
+        {
+            uint64_t sum = 0;
+            uint64_t state = 12345;
+
+            for (size_t i = 0; i < randomReads; ++i)
+            {
+                state = state * 6364136223846793005ull + 1442695040888963407ull;
+                sum += vector[(state >> 17) % vector.size()];
+            }
+
+            Bench::keep(sum);
+        });
+    }
+
+    void run(const char* name, size_t count, std::pmr::memory_resource* resource)
+    {
+        Containers::Vector<uint64_t> vector = makeVector(count, resource);
+        char line[64];
+
+        std::snprintf(line, sizeof(line), "%s: sequential sum", name);
+        Bench::report(line, sequentialAccess(vector));
+
+        std::snprintf(line, sizeof(line), "%s: %zu random reads", name, randomReads);
+        Bench::report(line, randomAccess(vector));
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const size_t megabytes = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : size_t(256);
+    const size_t count = megabytes * (size_t(1) << 20) / sizeof(uint64_t);
+
+    std::printf("Vector<uint64_t> of %zu MiB (%zu elements)\n", megabytes, count);
+
+    run("heap", count, nullptr);
+
+    Containers::AlignedResource pageAligned(Containers::AlignedResource::page);
+    run("AlignedResource (4 KiB)", count, &pageAligned);
+
+    Containers::HugePageResource hugePages;
+    run("HugePageResource (2 MiB)", count, &hugePages);
+
+    std::printf("huge-page blocks: %zu explicit (MAP_HUGETLB), %zu transparent (MADV_HUGEPAGE)\n",
+                hugePages.explicitAllocations(), hugePages.transparentAllocations());
+
+    return 0;
+}